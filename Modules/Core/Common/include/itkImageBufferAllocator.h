@@ -0,0 +1,184 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkImageBufferAllocator_h
+#define itkImageBufferAllocator_h
+
+#include "itkObject.h"
+#include "itkObjectFactory.h"
+#include "itkSingletonMacro.h"
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace itk
+{
+
+struct ImageBufferAllocatorGlobals;
+
+/** \class ImageBufferAllocator
+ * \brief Allocates and recycles the pixel buffers of images.
+ *
+ * ImageBufferAllocator hands out buffers aligned to Alignment bytes, so that
+ * the pixel data of an image may be processed with aligned SIMD loads. Buffers
+ * of at least HugePageSize bytes are aligned to HugePageSize instead and, on
+ * Linux, advised to be backed by transparent huge pages, which reduces the
+ * number of page faults and TLB misses when a large volume is first touched.
+ *
+ * Released buffers are kept in a pool, bucketed by their size, and handed out
+ * again when a buffer of the same size is requested, as happens when a
+ * pipeline is updated repeatedly. The pool holds at most PoolCapacity bytes;
+ * buffers which do not fit are returned to the system.
+ *
+ * No allocator is installed by default. Once one is installed with
+ * SetGlobalAllocator(), ImportImageContainer obtains the buffers of trivially
+ * constructible pixel types from it. Such buffers must not be freed with
+ * <tt>delete[]</tt>: a buffer taken over from a container with
+ * ContainerManageMemoryOff() is freed with DeallocateGlobal().
+ *
+ * All the methods are thread-safe.
+ *
+ * \sa ImportImageContainer
+ * \sa ImageBufferAllocatorMemoryUsageObserver
+ *
+ * \ingroup ImageObjects
+ * \ingroup ITKCommon
+ */
+class ITKCommon_EXPORT ImageBufferAllocator : public Object
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(ImageBufferAllocator);
+
+  /** Standard class type aliases. */
+  using Self = ImageBufferAllocator;
+  using Superclass = Object;
+  using Pointer = SmartPointer<Self>;
+  using ConstPointer = SmartPointer<const Self>;
+
+  /** Method for creation through the object factory. */
+  itkNewMacro(Self);
+
+  /** \see LightObject::GetNameOfClass() */
+  itkOverrideGetNameOfClassMacro(ImageBufferAllocator);
+
+  /** Alignment, in bytes, of every buffer. */
+  static constexpr size_t Alignment = 64;
+
+  /** Size, in bytes, from which buffers are aligned to, and advised to be
+   * backed by, transparent huge pages. */
+  static constexpr size_t HugePageSize = size_t{ 2 } << 20;
+
+  /** Allocate a buffer of the given number of bytes. Throws a
+   * MemoryAllocationError when the memory cannot be allocated. */
+  virtual void *
+  Allocate(size_t numberOfBytes);
+
+  /** Return a buffer obtained from Allocate() with the same number of bytes.
+   * The buffer is kept in the pool when it fits. */
+  virtual void
+  Deallocate(void * buffer, size_t numberOfBytes);
+
+  /** Return all the pooled buffers to the system. */
+  void
+  ReleasePool();
+
+  /** Maximum number of bytes kept in the pool. Defaults to 1 GiB. */
+  /** @ITKStartGrouping */
+  void
+  SetPoolCapacity(SizeValueType poolCapacity);
+  itkGetConstMacro(PoolCapacity, SizeValueType);
+  /** @ITKEndGrouping */
+  /** Whether large buffers are advised to be backed by transparent huge pages.
+   * Only effective on Linux. On by default. */
+  /** @ITKStartGrouping */
+  itkSetMacro(UseTransparentHugePages, bool);
+  itkGetConstMacro(UseTransparentHugePages, bool);
+  itkBooleanMacro(UseTransparentHugePages);
+  /** @ITKEndGrouping */
+  /** Allocation statistics. AllocatedBytes is the number of bytes currently
+   * handed out, PooledBytes the number of bytes held in the pool. */
+  /** @ITKStartGrouping */
+  SizeValueType
+  GetNumberOfAllocations() const;
+  SizeValueType
+  GetNumberOfPoolHits() const;
+  SizeValueType
+  GetAllocatedBytes() const;
+  SizeValueType
+  GetPeakAllocatedBytes() const;
+  SizeValueType
+  GetPooledBytes() const;
+  /** @ITKEndGrouping */
+  /** Set/Get the allocator used by ImportImageContainer. Null, the default,
+   * restores plain <tt>new[]</tt>. Buffers allocated before a change are
+   * still returned to the allocator which allocated them. */
+  /** @ITKStartGrouping */
+  static void
+  SetGlobalAllocator(Self * allocator);
+  static Pointer
+  GetGlobalAllocator();
+  /** @ITKEndGrouping */
+  /** Allocate a buffer from the global allocator, or return null when none
+   * is installed. The buffer is zero-filled when requested. */
+  static void *
+  AllocateGlobal(size_t numberOfBytes, bool zeroFill);
+
+  /** Return a buffer obtained from AllocateGlobal() to its allocator. Returns
+   * false, without doing anything, when the buffer was not obtained from
+   * AllocateGlobal(). */
+  static bool
+  DeallocateGlobal(void * buffer);
+
+protected:
+  ImageBufferAllocator() = default;
+  ~ImageBufferAllocator() override;
+
+  void
+  PrintSelf(std::ostream & os, Indent indent) const override;
+
+private:
+  /** Size of the bucket a request of numberOfBytes is served from. */
+  static size_t
+  GetBucketSize(size_t numberOfBytes);
+
+  void *
+  AllocateFromSystem(size_t bucketSize) const;
+
+  static void
+  DeallocateToSystem(void * buffer, size_t bucketSize);
+
+  void
+  TrimPool(SizeValueType poolCapacity);
+
+  itkGetGlobalDeclarationMacro(ImageBufferAllocatorGlobals, PimplGlobals);
+  static ImageBufferAllocatorGlobals * m_PimplGlobals;
+
+  SizeValueType m_PoolCapacity{ SizeValueType{ 1 } << 30 };
+  bool          m_UseTransparentHugePages{ true };
+
+  mutable std::mutex                              m_Mutex{};
+  std::unordered_map<size_t, std::vector<void *>> m_Pool{};
+  SizeValueType                                   m_NumberOfAllocations{ 0 };
+  SizeValueType                                   m_NumberOfPoolHits{ 0 };
+  SizeValueType                                   m_AllocatedBytes{ 0 };
+  SizeValueType                                   m_PeakAllocatedBytes{ 0 };
+  SizeValueType                                   m_PooledBytes{ 0 };
+};
+
+} // end namespace itk
+
+#endif
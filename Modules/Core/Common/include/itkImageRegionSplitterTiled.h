@@ -0,0 +1,130 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkImageRegionSplitterTiled_h
+#define itkImageRegionSplitterTiled_h
+
+#include "itkImageRegionSplitterBase.h"
+#include "itkNumericTraits.h"
+
+namespace itk
+{
+
+/** \class ImageRegionSplitterTiled
+ * \brief Divide an image region into cache-sized tiles.
+ *
+ * ImageRegionSplitterTiled divides an ImageRegion into rectangular tiles,
+ * splitting several dimensions like ImageRegionSplitterMultidimensional.
+ * The dimensions to split are chosen for the cache reuse of neighborhood
+ * filters:
+ *
+ * - The fastest dimension is only split when a tile spanning whole rows,
+ * padded by the kernel radius in every dimension, does not fit in
+ * CacheSize. Whole rows keep the memory accesses contiguous.
+ * - Among the other dimensions, the one with the largest tile extent is
+ * split first, which keeps the tiles compact and so limits the pixels
+ * read twice by neighboring tiles.
+ *
+ * Like the other splitters, it produces as many tiles as requested when
+ * the region allows it. It is therefore best combined with a
+ * MultiThreaderBase::SetOverDecomposition() factor, so that a region is
+ * divided into many small tiles scheduled over the threads, for example:
+ *
+ * \code
+ * auto splitter = itk::ImageRegionSplitterTiled::New();
+ * splitter->SetKernelRadius(2);
+ * filter->GetMultiThreader()->SetImageRegionSplitter(splitter);
+ * filter->GetMultiThreader()->SetOverDecomposition(8);
+ * \endcode
+ *
+ * \sa ImageRegionSplitterMultidimensional
+ *
+ * \ingroup ITKSystemObjects
+ * \ingroup DataProcessing
+ * \ingroup ITKCommon
+ */
+
+class ITKCommon_EXPORT ImageRegionSplitterTiled : public ImageRegionSplitterBase
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(ImageRegionSplitterTiled);
+
+  /** Standard class type aliases. */
+  using Self = ImageRegionSplitterTiled;
+  using Superclass = ImageRegionSplitterBase;
+  using Pointer = SmartPointer<Self>;
+  using ConstPointer = SmartPointer<const Self>;
+
+  /** Method for creation through the object factory. */
+  itkNewMacro(Self);
+
+  /** \see LightObject::GetNameOfClass() */
+  itkOverrideGetNameOfClassMacro(ImageRegionSplitterTiled);
+
+  /** Set/Get the number of bytes of cache a tile should fit in. Defaults to
+   * 256 KiB, a typical per-core L2 cache. */
+  /** @ITKStartGrouping */
+  itkSetClampMacro(CacheSize, SizeValueType, 1, NumericTraits<SizeValueType>::max());
+  itkGetConstMacro(CacheSize, SizeValueType);
+  /** @ITKEndGrouping */
+  /** Set/Get the number of bytes accessed per pixel of a tile, typically the
+   * size of an input pixel plus the size of an output pixel. Defaults to 8. */
+  /** @ITKStartGrouping */
+  itkSetClampMacro(BytesPerPixel, SizeValueType, 1, NumericTraits<SizeValueType>::max());
+  itkGetConstMacro(BytesPerPixel, SizeValueType);
+  /** @ITKEndGrouping */
+  /** Set/Get the radius of the neighborhood read around each pixel, by which
+   * the tiles are padded when estimating their cache footprint. Defaults to 0. */
+  /** @ITKStartGrouping */
+  itkSetMacro(KernelRadius, SizeValueType);
+  itkGetConstMacro(KernelRadius, SizeValueType);
+  /** @ITKEndGrouping */
+protected:
+  ImageRegionSplitterTiled();
+
+  unsigned int
+  GetNumberOfSplitsInternal(unsigned int         dim,
+                            const IndexValueType regionIndex[],
+                            const SizeValueType  regionSize[],
+                            unsigned int         requestedNumber) const override;
+
+  unsigned int
+  GetSplitInternal(unsigned int   dim,
+                   unsigned int   splitI,
+                   unsigned int   numberOfPieces,
+                   IndexValueType regionIndex[],
+                   SizeValueType  regionSize[]) const override;
+
+  void
+  PrintSelf(std::ostream & os, Indent indent) const override;
+
+private:
+  /** Computes the number of tiles along each dimension, and returns their
+   * product. */
+  unsigned int
+  ComputeSplits(unsigned int        dim,
+                unsigned int        requestedNumber,
+                const SizeValueType regionSize[],
+                unsigned int        splits[]) const;
+
+  SizeValueType m_CacheSize{ 256 * 1024 };
+  SizeValueType m_BytesPerPixel{ 8 };
+  SizeValueType m_KernelRadius{ 0 };
+};
+} // end namespace itk
+
+#endif
@@ -36,6 +36,8 @@ namespace itk
  *
  * \tparam TElement The element type stored in the container.
  *
+ * \sa ImageBufferAllocator
+ *
  * \ingroup ImageObjects
  * \ingroup IOFilters
  * \ingroup ITKCommon
@@ -172,7 +174,8 @@ protected:
 
   /**
    * Allocates elements of the array.  If UseValueInitialization is true, then
-   * POD types will be zero-initialized.
+   * POD types will be zero-initialized. When an ImageBufferAllocator is
+   * installed, trivially constructible elements are allocated from it.
    */
   virtual TElement *
   AllocateElements(ElementIdentifier size, bool UseValueInitialization = false) const;
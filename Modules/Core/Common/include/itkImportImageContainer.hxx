@@ -28,7 +28,10 @@
 #ifndef itkImportImageContainer_hxx
 #define itkImportImageContainer_hxx
 
+#include "itkImageBufferAllocator.h"
+#include "itkTraceEventRecorder.h"
 #include <algorithm> // For copy_n.
+#include <type_traits>
 
 namespace itk
 {
@@ -155,6 +158,17 @@ TElement *
 ImportImageContainer<TElementIdentifier, TElement>::AllocateElements(ElementIdentifier size,
                                                                      bool              UseValueInitialization) const
 {
+  const TraceEventScope traceEvent("Allocate", this->GetNameOfClass(), size * sizeof(TElement));
+
+  if constexpr (std::is_trivially_default_constructible_v<TElement> && std::is_trivially_destructible_v<TElement> &&
+                alignof(TElement) <= ImageBufferAllocator::Alignment)
+  {
+    if (void * buffer = ImageBufferAllocator::AllocateGlobal(size * sizeof(TElement), UseValueInitialization))
+    {
+      return static_cast<TElement *>(buffer);
+    }
+  }
+
   TElement * data = nullptr;
 
   try
@@ -186,7 +200,7 @@ void
 ImportImageContainer<TElementIdentifier, TElement>::DeallocateManagedMemory()
 {
   // Encapsulate all image memory deallocation here
-  if (m_ContainerManageMemory)
+  if (m_ContainerManageMemory && !ImageBufferAllocator::DeallocateGlobal(m_ImportPointer))
   {
     delete[] m_ImportPointer;
   }
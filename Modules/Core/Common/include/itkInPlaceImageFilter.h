@@ -126,6 +126,25 @@ public:
   [[nodiscard]] virtual bool
   CanRunInPlace() const;
 
+  /** Expose the InPlace setting through the ProcessObject interface. */
+  /** @ITKStartGrouping */
+  [[nodiscard]] bool
+  SupportsInPlace() const override
+  {
+    return this->CanRunInPlace();
+  }
+  [[nodiscard]] bool
+  GetInPlaceExecution() const override
+  {
+    return this->GetInPlace();
+  }
+  void
+  SetInPlaceExecution(bool inPlace) override
+  {
+    this->SetInPlace(inPlace);
+  }
+  /** @ITKEndGrouping */
+
 protected:
   InPlaceImageFilter() = default;
   ~InPlaceImageFilter() override = default;
@@ -146,6 +146,25 @@ public:
 #  endif // Mallinfo
 #endif   // !defined(WIN32) && !defined(_WIN32)
 
+/** \class ImageBufferAllocatorMemoryUsageObserver
+ * \brief Reports the memory held by the global ImageBufferAllocator
+ *
+ * The memory usage is the number of bytes handed out by the allocator
+ * installed with ImageBufferAllocator::SetGlobalAllocator(), plus the bytes
+ * held in its pool, or zero when no allocator is installed.
+ *
+ * \ingroup ITKCommon
+ */
+class ITKCommon_EXPORT ImageBufferAllocatorMemoryUsageObserver : public MemoryUsageObserverBase
+{
+public:
+  /** destructor */
+  ~ImageBufferAllocatorMemoryUsageObserver() override;
+
+  MemoryLoadType
+  GetMemoryUsage() override;
+};
+
 /* \class MemoryUsageObserver
  * The best MemoryUsageObserver has been chosen for each OS.
  * However, SysResourceMemoryUsageObserver is far from being accurate. Other
@@ -34,7 +34,10 @@
 #include "itkIntTypes.h"
 #include "itkImageRegion.h"
 #include "itkImageIORegion.h"
+#include "itkImageRegionSplitterBase.h"
+#include "itkNumericTraits.h"
 #include "itkSingletonMacro.h"
+#include "itkTraceEventRecorder.h"
 #include <atomic>
 #include <functional>
 #include <thread>
@@ -141,6 +144,37 @@ public:
   SetUpdateProgress(bool updates);
   itkGetConstMacro(UpdateProgress, bool);
 
+  /** Set/Get the splitter used by ParallelizeImageRegion() to divide the
+   * region into work units. When none is set, the global default splitter of
+   * ImageSource, an ImageRegionSplitterSlowDimension, is used. TBBMultiThreader
+   * ignores it, letting TBB partition the region. */
+  /** @ITKStartGrouping */
+  virtual void
+  SetImageRegionSplitter(const ImageRegionSplitterBase * splitter);
+  virtual const ImageRegionSplitterBase *
+  GetImageRegionSplitter() const;
+  /** @ITKEndGrouping */
+  /** Set/Get the factor by which PoolMultiThreader::ParallelizeImageRegion()
+   * over-decomposes the region: it is divided into up to NumberOfWorkUnits
+   * times OverDecomposition pieces, which the threads pick one after the
+   * other until none is left. Smaller pieces balance the load better and
+   * fit better in the cache, at the cost of more scheduling. Defaults to 1. */
+  /** @ITKStartGrouping */
+  itkSetClampMacro(OverDecomposition, unsigned int, 1, NumericTraits<unsigned int>::max());
+  itkGetConstMacro(OverDecomposition, unsigned int);
+  /** @ITKEndGrouping */
+  /** Set/Get whether PoolMultiThreader::ParallelizeImageRegion() adjusts
+   * OverDecomposition after each call from the measured times of its pieces.
+   * It is halved when the pieces are so short that scheduling them costs a
+   * noticeable part of their time, and doubled when the threads finish at
+   * noticeably different times. The adjusted value is used by the next call,
+   * so it converges over repeated updates of the same filter. */
+  /** @ITKStartGrouping */
+  itkSetMacro(AutoTuneOverDecomposition, bool);
+  itkGetConstMacro(AutoTuneOverDecomposition, bool);
+  itkBooleanMacro(AutoTuneOverDecomposition);
+  /** @ITKEndGrouping */
+
   /** Set/Get the maximum number of threads to use when multithreading.  It
    * will be clamped to the range [ 1, ITK_MAX_THREADS ] because several arrays
    * are already statically allocated using the ITK_MAX_THREADS number.
@@ -355,7 +389,9 @@ ITK_GCC_PRAGMA_DIAG_POP()
       VDimension,
       requestedRegion.GetIndex().m_InternalArray,
       requestedRegion.GetSize().m_InternalArray,
-      [&funcP](const IndexValueType index[], const SizeValueType size[]) {
+      [&funcP, filter](const IndexValueType index[], const SizeValueType size[]) {
+        const TraceEventScope traceEvent("WorkUnit", filter ? filter->GetNameOfClass() : "ParallelizeImageRegion");
+
         ImageRegion<VDimension> region;
         for (unsigned int d = 0; d < VDimension; ++d)
         {
@@ -403,7 +439,10 @@ ITK_GCC_PRAGMA_DIAG_POP()
         SplitDimension,
         splitIndex.m_InternalArray,
         splitSize.m_InternalArray,
-        [restrictedDirection, &requestedRegion, &funcP](const IndexValueType index[], const SizeValueType size[]) {
+        [restrictedDirection, &requestedRegion, &funcP, filter](const IndexValueType index[],
+                                                                const SizeValueType  size[]) {
+          const TraceEventScope traceEvent("WorkUnit", filter ? filter->GetNameOfClass() : "ParallelizeImageRegion");
+
           ImageRegion<VDimension> restrictedRequestedRegion;
           restrictedRequestedRegion.SetIndex(restrictedDirection, requestedRegion.GetIndex(restrictedDirection));
           restrictedRequestedRegion.SetSize(restrictedDirection, requestedRegion.GetSize(restrictedDirection));
@@ -450,11 +489,12 @@ protected:
 
   struct RegionAndCallback
   {
-    ThreadingFunctorType   functor;
-    unsigned int           dimension;
-    const IndexValueType * index;
-    const SizeValueType *  size;
-    ProcessObject *        filter;
+    ThreadingFunctorType            functor;
+    unsigned int                    dimension;
+    const IndexValueType *          index;
+    const SizeValueType *           size;
+    ProcessObject *                 filter;
+    const ImageRegionSplitterBase * splitter;
   };
 
   static ITK_THREAD_RETURN_FUNCTION_CALL_CONVENTION
@@ -463,6 +503,14 @@ protected:
   /** The number of work units to create. */
   ThreadIdType m_NumberOfWorkUnits{};
 
+  /** The factor by which ParallelizeImageRegion over-decomposes regions. */
+  unsigned int m_OverDecomposition{ 1 };
+
+  bool m_AutoTuneOverDecomposition{ false };
+
+  /** The splitter of ParallelizeImageRegion, or nullptr for the default. */
+  ImageRegionSplitterBase::ConstPointer m_ImageRegionSplitter{};
+
   /** The number of threads to use.
    *  The m_MaximumNumberOfThreads must always be less than or equal to
    *  the m_GlobalMaximumNumberOfThreads before it is used during the execution
@@ -19,9 +19,12 @@
 #define itkNeighborhoodAlgorithm_h
 
 #include <list>
+#include "itkBufferedImageNeighborhoodPixelAccessPolicy.h"
 #include "itkImage.h"
 #include "itkNeighborhoodOperator.h"
 #include "itkNeighborhoodIterator.h"
+#include "itkShapedImageNeighborhoodRange.h"
+#include "itkZeroFluxNeumannImageNeighborhoodPixelAccessPolicy.h"
 
 namespace itk::NeighborhoodAlgorithm
 {
@@ -136,6 +139,43 @@ struct CalculateOutputWrapOffsetModifiers
   OffsetType
   operator()(TImage *, TImage *) const;
 };
+
+/**
+ * Splits the specified region into a non-boundary region and boundary faces,
+ * according to the radius of the specified neighborhood shape, and calls the
+ * specified function once for each of them, as `function(region, range)`.
+ * The `range` argument is a ShapedImageNeighborhoodRange of the specified
+ * shape: for the non-boundary region, it accesses the pixels without any
+ * bounds checking; for the boundary faces, it uses the specified boundary
+ * pixel access policy, constructed with the optional boundary parameter
+ * (for example the constant value of
+ * ConstantBoundaryImageNeighborhoodPixelAccessPolicy). So the function is
+ * typically a generic lambda, for example:
+ *
+ * \code
+ * NeighborhoodAlgorithm::ProcessNonBoundaryRegionAndBoundaryFaces(
+ *   *inputImage, outputRegionForThread, offsets, [&](const auto & region, auto & neighborhoodRange) {
+ *     for (const auto & index : MakeIndexRange(region))
+ *     {
+ *       neighborhoodRange.SetLocation(index);
+ *       outputImage->SetPixel(index, std::accumulate(neighborhoodRange.cbegin(), neighborhoodRange.cend(), 0.0));
+ *     }
+ *   });
+ * \endcode
+ *
+ * \ingroup ITKCommon
+ */
+template <template <typename> class TBoundaryPixelAccessPolicy = ZeroFluxNeumannImageNeighborhoodPixelAccessPolicy,
+          typename TImage,
+          typename TContainerOfOffsets,
+          typename TFunction,
+          typename... TBoundaryParameter>
+void
+ProcessNonBoundaryRegionAndBoundaryFaces(TImage &                            image,
+                                         const typename TImage::RegionType & regionToProcess,
+                                         const TContainerOfOffsets &         shapeOffsets,
+                                         TFunction &&                        function,
+                                         const TBoundaryParameter &... boundaryParameter);
 } // namespace itk::NeighborhoodAlgorithm
 
 #ifndef ITK_MANUAL_INSTANTIATION
@@ -20,6 +20,7 @@
 #include "itkImageRegionIterator.h"
 #include "itkImageRegion.h"
 #include "itkConstSliceIterator.h"
+#include "itkMath.h"
 #include <algorithm> // For min.
 
 namespace itk::NeighborhoodAlgorithm
@@ -185,6 +186,54 @@ CalculateOutputWrapOffsetModifiers<TImage>::operator()(TImage * input, TImage *
   }
   return ans;
 }
+
+template <template <typename> class TBoundaryPixelAccessPolicy,
+          typename TImage,
+          typename TContainerOfOffsets,
+          typename TFunction,
+          typename... TBoundaryParameter>
+void
+ProcessNonBoundaryRegionAndBoundaryFaces(TImage &                            image,
+                                         const typename TImage::RegionType & regionToProcess,
+                                         const TContainerOfOffsets &         shapeOffsets,
+                                         TFunction &&                        function,
+                                         const TBoundaryParameter &... boundaryParameter)
+{
+  static_assert(sizeof...(TBoundaryParameter) <= 1, "At most one boundary parameter should be specified!");
+
+  using ImageType = std::remove_const_t<TImage>;
+  using FacesCalculatorType = ImageBoundaryFacesCalculator<ImageType>;
+  using RadiusType = typename FacesCalculatorType::RadiusType;
+  using IndexType = typename TImage::IndexType;
+
+  // The radius of the shape is the largest offset component along each dimension.
+  RadiusType radius{};
+  for (const auto & offset : shapeOffsets)
+  {
+    for (unsigned int i = 0; i < TImage::ImageDimension; ++i)
+    {
+      radius[i] = std::max(radius[i], static_cast<SizeValueType>(itk::Math::abs(offset[i])));
+    }
+  }
+
+  const auto calculatorResult = FacesCalculatorType::Compute(image, regionToProcess, radius);
+
+  if (const auto nonBoundaryRegion = calculatorResult.GetNonBoundaryRegion(); nonBoundaryRegion.GetNumberOfPixels() > 0)
+  {
+    auto neighborhoodRange =
+      ShapedImageNeighborhoodRange<TImage, BufferedImageNeighborhoodPixelAccessPolicy<ImageType>>(
+        image, IndexType(), shapeOffsets);
+    function(nonBoundaryRegion, neighborhoodRange);
+  }
+
+  for (const auto & face : calculatorResult.GetBoundaryFaces())
+  {
+    auto neighborhoodRange = ShapedImageNeighborhoodRange<TImage, TBoundaryPixelAccessPolicy<ImageType>>(
+      image, IndexType(), shapeOffsets, boundaryParameter...);
+    function(face, neighborhoodRange);
+  }
+}
+
 } // namespace itk::NeighborhoodAlgorithm
 
 #endif
@@ -0,0 +1,150 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkPipelineMemoryPlanner_h
+#define itkPipelineMemoryPlanner_h
+
+#include "itkProcessObject.h"
+#include <string>
+#include <vector>
+
+namespace itk
+{
+
+/** \class PipelineMemoryPlanner
+ * \brief Updates a pipeline while keeping as few intermediate results as possible.
+ *
+ * PipelineMemoryPlanner updates a DataObject, after analysing the pipeline
+ * which produces it: the ProcessObjects reachable upstream from the output,
+ * and the DataObjects which connect them. During the update:
+ *
+ * - the bulk data of an intermediate DataObject is released as soon as the
+ *   last ProcessObject which consumes it has executed, rather than being
+ *   kept until the end of the update, or released after its first consumer
+ *   (as the ReleaseDataFlag does, which makes the other consumers execute the
+ *   upstream pipeline again);
+ * - a ProcessObject which supports in-place execution (see
+ *   ProcessObject::SupportsInPlace()) is allowed to overwrite its input when
+ *   all of its inputs are intermediate DataObjects that no other
+ *   ProcessObject consumes, and is prevented from doing so otherwise.
+ *
+ * The output itself, DataObjects without a source (such as images set
+ * directly as the input of a filter), and the DataObjects added with
+ * AddPersistentDataObject() are never released nor overwritten. Consumers are
+ * only known within the analysed pipeline, so an intermediate DataObject which
+ * is also used elsewhere must be added as a persistent DataObject. The InPlace
+ * settings of the ProcessObjects are restored after the update.
+ *
+ * The executed schedule is reported by GetSchedule(). When an
+ * ImageBufferAllocator is installed, the schedule includes the number of
+ * bytes allocated at the end of each step, before its inputs are released, so
+ * that the peak memory use of the pipeline may be located.
+ *
+ * \sa ProcessObject::SetReleaseDataFlag()
+ * \sa InPlaceImageFilter
+ * \sa ImageBufferAllocator
+ *
+ * \ingroup DataProcessing
+ * \ingroup ITKCommon
+ */
+class ITKCommon_EXPORT PipelineMemoryPlanner : public Object
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(PipelineMemoryPlanner);
+
+  /** Standard class type aliases. */
+  using Self = PipelineMemoryPlanner;
+  using Superclass = Object;
+  using Pointer = SmartPointer<Self>;
+  using ConstPointer = SmartPointer<const Self>;
+
+  /** Method for creation through the object factory. */
+  itkNewMacro(Self);
+
+  /** \see LightObject::GetNameOfClass() */
+  itkOverrideGetNameOfClassMacro(PipelineMemoryPlanner);
+
+  /** Set/Get the DataObject to update. */
+  /** @ITKStartGrouping */
+  itkSetObjectMacro(Output, DataObject);
+  itkGetModifiableObjectMacro(Output, DataObject);
+  /** @ITKEndGrouping */
+  /** Add a DataObject whose bulk data must be kept, for instance because it
+   * is also used outside of the pipeline. */
+  void
+  AddPersistentDataObject(const DataObject * dataObject);
+
+  /** Remove all the persistent DataObjects. */
+  void
+  ClearPersistentDataObjects();
+
+  /** Whether in-place execution is planned. When off, the InPlace settings of
+   * the ProcessObjects are left untouched. On by default. */
+  /** @ITKStartGrouping */
+  itkSetMacro(PlanInPlaceExecution, bool);
+  itkGetConstMacro(PlanInPlaceExecution, bool);
+  itkBooleanMacro(PlanInPlaceExecution);
+  /** @ITKEndGrouping */
+
+  /** One executed step of the schedule. */
+  struct ScheduleStep
+  {
+    /** Class name of the executed ProcessObject. */
+    std::string ProcessObjectName;
+    /** Whether the ProcessObject was allowed to run in place. */
+    bool InPlace{ false };
+    /** Number of intermediate DataObjects released after the step. */
+    SizeValueType NumberOfReleasedDataObjects{ 0 };
+    /** Bytes allocated by the global ImageBufferAllocator at the end of the
+     * step, before releasing its inputs; zero when none is installed. */
+    SizeValueType AllocatedBytes{ 0 };
+  };
+  using ScheduleType = std::vector<ScheduleStep>;
+
+  /** Analyse the pipeline and update the output. */
+  void
+  Update();
+
+  /** Get the schedule executed by the last Update(). */
+  [[nodiscard]] const ScheduleType &
+  GetSchedule() const
+  {
+    return m_Schedule;
+  }
+
+  /** Get the largest number of bytes allocated at the end of a step of the
+   * last Update(). */
+  itkGetConstMacro(PeakAllocatedBytes, SizeValueType);
+
+protected:
+  PipelineMemoryPlanner() = default;
+  ~PipelineMemoryPlanner() override = default;
+
+  void
+  PrintSelf(std::ostream & os, Indent indent) const override;
+
+private:
+  DataObject::Pointer             m_Output{};
+  std::vector<const DataObject *> m_PersistentDataObjects{};
+  bool                            m_PlanInPlaceExecution{ true };
+  ScheduleType                    m_Schedule{};
+  SizeValueType                   m_PeakAllocatedBytes{ 0 };
+};
+
+} // end namespace itk
+
+#endif
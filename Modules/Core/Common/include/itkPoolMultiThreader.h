@@ -116,6 +116,14 @@ private:
     std::future<void> Future;
   };
 
+  /** Divide the region into up to NumberOfWorkUnits times OverDecomposition
+   * pieces, let the threads process them until none is left, and adjust
+   * OverDecomposition when AutoTuneOverDecomposition is on. */
+  void
+  ParallelizeOverDecomposedImageRegion(const ImageIORegion &        region,
+                                       const ThreadingFunctorType & funcP,
+                                       ProcessObject *              filter);
+
   // Thread pool instance and factory
   ThreadPool::Pointer m_ThreadPool{};
 
@@ -33,6 +33,7 @@
 #include "itkNumericTraits.h"
 #include "itkThreadSupport.h"
 #include "itkIntTypes.h"
+#include "itkUpdateFuture.h"
 #include <vector>
 #include <map>
 #include <set>
@@ -390,6 +391,22 @@ public:
   virtual void
   UpdateLargestPossibleRegion();
 
+  /** \brief Update() or UpdateLargestPossibleRegion() in another thread.
+   *
+   * The returned UpdateFuture may be waited for, reports the progress of the
+   * update, rethrows the exception which ended it, and may cancel it. The
+   * pipeline must not be modified, nor updated otherwise, until the update is
+   * ready.
+   *
+   * \sa UpdateFuture
+   */
+  /** @ITKStartGrouping */
+  UpdateFuture
+  UpdateAsync();
+  UpdateFuture
+  UpdateLargestPossibleRegionAsync();
+  /** @ITKEndGrouping */
+
   /** \brief Update the information describing the output data.
    *
    * This method
@@ -498,6 +515,45 @@ public:
   itkBooleanMacro(ReleaseDataBeforeUpdateFlag);
   /** @ITKEndGrouping */
 
+  /** Whether this ProcessObject can overwrite the bulk data of its primary
+   * input with its primary output, and whether it is allowed to. A
+   * ProcessObject does not run in place by default; InPlaceImageFilter
+   * overrides these methods to expose its InPlace setting, so that in-place
+   * execution may be decided for a whole pipeline.
+   *
+   * \sa InPlaceImageFilter
+   * \sa PipelineMemoryPlanner */
+  /** @ITKStartGrouping */
+  [[nodiscard]] virtual bool
+  SupportsInPlace() const
+  {
+    return false;
+  }
+  [[nodiscard]] virtual bool
+  GetInPlaceExecution() const
+  {
+    return false;
+  }
+  virtual void
+  SetInPlaceExecution(bool)
+  {}
+  /** @ITKEndGrouping */
+
+  /** Turn on/off the concurrent update of the inputs of this ProcessObject.
+   * When on, and the pipelines upstream of the inputs are independent (they
+   * share no ProcessObject, and no input is overwritten in place by a
+   * ProcessObject of another branch), each of them is updated in its own
+   * thread, rather than one after the other. The requested regions of all the
+   * inputs are propagated before any of them is updated. Otherwise the inputs
+   * are updated one after the other, as usual. Note that the events of the
+   * upstream ProcessObjects, such as StartEvent and EndEvent, are then
+   * invoked from several threads. Default value is off. */
+  /** @ITKStartGrouping */
+  itkSetMacro(UpdateInputsConcurrently, bool);
+  itkGetConstMacro(UpdateInputsConcurrently, bool);
+  itkBooleanMacro(UpdateInputsConcurrently);
+  /** @ITKEndGrouping */
+
   /** Get/Set the number of work units to create when executing. */
   /** @ITKStartGrouping */
   itkSetClampMacro(NumberOfWorkUnits, ThreadIdType, 1, ITK_MAX_THREADS);
@@ -970,6 +1026,11 @@ protected:
   TimeStamp m_OutputInformationMTime{};
 
 private:
+  /** Whether the pipelines upstream of the inputs may be updated concurrently.
+   * \sa SetUpdateInputsConcurrently() */
+  bool
+  InputBranchesAreIndependent();
+
   DataObjectIdentifierType MakeNameFromIndex(DataObjectPointerArraySizeType) const;
   DataObjectPointerArraySizeType
   MakeIndexFromName(const DataObjectIdentifierType &) const;
@@ -1014,6 +1075,8 @@ private:
   /** Memory management ivars */
   bool m_ReleaseDataBeforeUpdateFlag{};
 
+  bool m_UpdateInputsConcurrently{ false };
+
   /** Friends of ProcessObject */
   friend class DataObject;
 
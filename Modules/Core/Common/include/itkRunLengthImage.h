@@ -0,0 +1,198 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkRunLengthImage_h
+#define itkRunLengthImage_h
+
+#include "itkImage.h"
+
+#include <vector>
+
+namespace itk
+{
+/** \class RunLengthImage
+ *  \brief Image whose pixels are stored as runs of equal values along the
+ *  fastest dimension.
+ *
+ * RunLengthImage stores each line of its buffered region, along the first
+ * dimension, as a sequence of runs: a value and the number of consecutive
+ * pixels that have this value. Label images, where large areas share a
+ * label, typically take tens of times less memory than as an Image.
+ *
+ * A run is at most NumericTraits<TRunLength>::max() pixels long, so that
+ * TRunLength may be chosen as small as the lines allow. Longer uniform
+ * lines are stored as several runs.
+ *
+ * The image has the geometry of an ImageBase, and the pixels are
+ * accessed through GetPixel() and SetPixel(), which cost a search along
+ * the runs of the line, or by whole lines through GetLine() and SetLine().
+ * ImageRegionConstIterator and ImageScanlineConstIterator are specialized
+ * for RunLengthImage (see itkRunLengthImageConstIterator.h): they decode
+ * the runs as they advance, so that filters which read their inputs
+ * through these iterators, such as LabelStatisticsImageFilter,
+ * LabelOverlapMeasuresImageFilter or ChangeLabelImageFilter, accept a
+ * RunLengthImage input without decoding it first.
+ *
+ * As there is no pixel buffer, GetBufferPointer() and the writing
+ * iterators are not available: a RunLengthImage is produced by
+ * CopyFromImage(), by SetLine() or by SetPixel().
+ *
+ * \sa Image
+ * \sa LabelObjectLine
+ *
+ * \ingroup ImageObjects
+ * \ingroup ITKCommon
+ */
+template <typename TPixel, unsigned int VImageDimension = 2, typename TRunLength = unsigned short>
+class ITK_TEMPLATE_EXPORT RunLengthImage : public ImageBase<VImageDimension>
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(RunLengthImage);
+
+  /** Standard class type aliases */
+  using Self = RunLengthImage;
+  using Superclass = ImageBase<VImageDimension>;
+  using Pointer = SmartPointer<Self>;
+  using ConstPointer = SmartPointer<const Self>;
+
+  /** Method for creation through the object factory. */
+  itkNewMacro(Self);
+
+  /** \see LightObject::GetNameOfClass() */
+  itkOverrideGetNameOfClassMacro(RunLengthImage);
+
+  /** Pixel type alias support. */
+  using PixelType = TPixel;
+  using ValueType = TPixel;
+  using InternalPixelType = TPixel;
+  using IOPixelType = PixelType;
+
+  /** Type of the length of a run. */
+  using RunLengthType = TRunLength;
+
+  /** A run of RunLength pixels of the same Value. */
+  struct RunType
+  {
+    RunLengthType RunLength;
+    PixelType     Value;
+  };
+
+  /** The runs of a line, covering the buffered region along the first
+   * dimension. */
+  using LineType = std::vector<RunType>;
+
+  /** The Image type with the same pixels. */
+  using ImageType = Image<TPixel, VImageDimension>;
+
+  using typename Superclass::ImageDimensionType;
+  using typename Superclass::IndexType;
+  using typename Superclass::IndexValueType;
+  using typename Superclass::OffsetType;
+  using typename Superclass::SizeType;
+  using typename Superclass::SizeValueType;
+  using typename Superclass::RegionType;
+  using typename Superclass::SpacingType;
+  using typename Superclass::PointType;
+  using typename Superclass::DirectionType;
+
+  /** Dimension of the image. */
+  static constexpr unsigned int ImageDimension = VImageDimension;
+
+  /** Allocates the lines of the buffered region, each as a single run (or as
+   * few runs as RunLengthType allows) of zero valued pixels. The pixels are
+   * always initialized, whatever the `initialize` argument. */
+  void
+  Allocate(bool initialize = false) override;
+
+  /** Restores the object to its initial state, releasing the runs. */
+  void
+  Initialize() override;
+
+  /** Fills the buffered region with a single value. */
+  void
+  FillBuffer(const PixelType & value);
+
+  /** Returns the value of the pixel at the specified index, which must be
+   * inside the buffered region. */
+  [[nodiscard]] PixelType
+  GetPixel(const IndexType & index) const;
+
+  /** Sets the value of the pixel at the specified index, which must be inside
+   * the buffered region, splitting and merging the runs of its line. */
+  void
+  SetPixel(const IndexType & index, const PixelType & value);
+
+  /** Returns the runs of the line that contains the specified index. Only the
+   * components of the index after the first one are used. */
+  [[nodiscard]] const LineType &
+  GetLine(const IndexType & index) const
+  {
+    return m_Lines[this->ComputeLineNumber(index)];
+  }
+
+  /** Replaces the runs of the line that contains the specified index. The
+   * lengths of the runs must add up to the size of the buffered region along
+   * the first dimension. */
+  void
+  SetLine(const IndexType & index, LineType line);
+
+  /** Returns the number of runs in the buffered region. */
+  [[nodiscard]] SizeValueType
+  GetNumberOfRuns() const;
+
+  /** Copies the information and the buffered region of the specified image,
+   * and encodes its pixels. */
+  void
+  CopyFromImage(const ImageType * image);
+
+  /** Copies the information and the buffered region of this image to the
+   * specified one, which is allocated, and decodes the pixels. */
+  void
+  CopyToImage(ImageType * image) const;
+
+protected:
+  RunLengthImage() = default;
+  ~RunLengthImage() override = default;
+
+  void
+  PrintSelf(std::ostream & os, Indent indent) const override;
+
+private:
+  /** Returns the position of the line that contains the specified index, in
+   * the buffered region, with the fastest dimension first. */
+  [[nodiscard]] SizeValueType
+  ComputeLineNumber(const IndexType & index) const;
+
+  /** Returns a line of the specified length, with a single value. */
+  [[nodiscard]] static LineType
+  MakeUniformLine(SizeValueType lineLength, const PixelType & value);
+
+  /** Appends runs of a single value to a line. */
+  static void
+  AppendRuns(LineType & line, SizeValueType numberOfPixels, const PixelType & value);
+
+  std::vector<LineType> m_Lines{};
+};
+} // end namespace itk
+
+#include "itkRunLengthImageConstIterator.h"
+
+#ifndef ITK_MANUAL_INSTANTIATION
+#  include "itkRunLengthImage.hxx"
+#endif
+
+#endif
@@ -0,0 +1,285 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkRunLengthImage_hxx
+#define itkRunLengthImage_hxx
+
+#include "itkImageScanlineIterator.h"
+#include "itkMath.h"
+
+namespace itk
+{
+
+template <typename TPixel, unsigned int VImageDimension, typename TRunLength>
+void
+RunLengthImage<TPixel, VImageDimension, TRunLength>::Allocate(bool itkNotUsed(initialize))
+{
+  const RegionType & bufferedRegion = this->GetBufferedRegion();
+
+  SizeValueType numberOfLines = 1;
+  for (unsigned int i = 1; i < VImageDimension; ++i)
+  {
+    numberOfLines *= bufferedRegion.GetSize(i);
+  }
+
+  m_Lines.assign(numberOfLines, MakeUniformLine(bufferedRegion.GetSize(0), PixelType{}));
+}
+
+template <typename TPixel, unsigned int VImageDimension, typename TRunLength>
+void
+RunLengthImage<TPixel, VImageDimension, TRunLength>::Initialize()
+{
+  Superclass::Initialize();
+
+  m_Lines = {};
+}
+
+template <typename TPixel, unsigned int VImageDimension, typename TRunLength>
+void
+RunLengthImage<TPixel, VImageDimension, TRunLength>::FillBuffer(const PixelType & value)
+{
+  const LineType uniformLine = MakeUniformLine(this->GetBufferedRegion().GetSize(0), value);
+  for (LineType & line : m_Lines)
+  {
+    line = uniformLine;
+  }
+}
+
+template <typename TPixel, unsigned int VImageDimension, typename TRunLength>
+auto
+RunLengthImage<TPixel, VImageDimension, TRunLength>::GetPixel(const IndexType & index) const -> PixelType
+{
+  const LineType & line = m_Lines[this->ComputeLineNumber(index)];
+
+  auto x = static_cast<SizeValueType>(index[0] - this->GetBufferedRegion().GetIndex(0));
+  for (const RunType & run : line)
+  {
+    if (x < run.RunLength)
+    {
+      return run.Value;
+    }
+    x -= run.RunLength;
+  }
+  itkExceptionMacro("Index " << index << " is outside the buffered region " << this->GetBufferedRegion());
+}
+
+template <typename TPixel, unsigned int VImageDimension, typename TRunLength>
+void
+RunLengthImage<TPixel, VImageDimension, TRunLength>::SetPixel(const IndexType & index, const PixelType & value)
+{
+  LineType & line = m_Lines[this->ComputeLineNumber(index)];
+
+  // Find the run that contains the pixel.
+  auto   x = static_cast<SizeValueType>(index[0] - this->GetBufferedRegion().GetIndex(0));
+  size_t runIndex = 0;
+  for (; runIndex < line.size() && x >= line[runIndex].RunLength; ++runIndex)
+  {
+    x -= line[runIndex].RunLength;
+  }
+  if (runIndex == line.size())
+  {
+    itkExceptionMacro("Index " << index << " is outside the buffered region " << this->GetBufferedRegion());
+  }
+
+  const RunType run = line[runIndex];
+  if (Math::ExactlyEquals(run.Value, value))
+  {
+    return;
+  }
+
+  // Split the run in the pixels before, the pixel itself, and the pixels
+  // after.
+  const auto before = static_cast<RunLengthType>(x);
+  const auto after = static_cast<RunLengthType>(run.RunLength - x - 1);
+
+  line[runIndex] = RunType{ 1, value };
+  if (after > 0)
+  {
+    line.insert(line.begin() + runIndex + 1, RunType{ after, run.Value });
+  }
+  if (before > 0)
+  {
+    line.insert(line.begin() + runIndex, RunType{ before, run.Value });
+    ++runIndex;
+  }
+
+  // Merge the pixel with the neighboring runs of the same value, as long as
+  // the merged run length fits in RunLengthType.
+  constexpr SizeValueType maximumRunLength = NumericTraits<RunLengthType>::max();
+  if (runIndex + 1 < line.size() && Math::ExactlyEquals(line[runIndex + 1].Value, value) &&
+      SizeValueType{ line[runIndex].RunLength } + line[runIndex + 1].RunLength <= maximumRunLength)
+  {
+    line[runIndex].RunLength += line[runIndex + 1].RunLength;
+    line.erase(line.begin() + runIndex + 1);
+  }
+  if (runIndex > 0 && Math::ExactlyEquals(line[runIndex - 1].Value, value) &&
+      SizeValueType{ line[runIndex - 1].RunLength } + line[runIndex].RunLength <= maximumRunLength)
+  {
+    line[runIndex - 1].RunLength += line[runIndex].RunLength;
+    line.erase(line.begin() + runIndex);
+  }
+}
+
+template <typename TPixel, unsigned int VImageDimension, typename TRunLength>
+void
+RunLengthImage<TPixel, VImageDimension, TRunLength>::SetLine(const IndexType & index, LineType line)
+{
+  SizeValueType lineLength = 0;
+  for (const RunType & run : line)
+  {
+    lineLength += run.RunLength;
+  }
+  if (lineLength != this->GetBufferedRegion().GetSize(0))
+  {
+    itkExceptionMacro("The runs of the line cover " << lineLength << " pixels instead of "
+                                                    << this->GetBufferedRegion().GetSize(0) << '.');
+  }
+  m_Lines[this->ComputeLineNumber(index)] = std::move(line);
+}
+
+template <typename TPixel, unsigned int VImageDimension, typename TRunLength>
+auto
+RunLengthImage<TPixel, VImageDimension, TRunLength>::GetNumberOfRuns() const -> SizeValueType
+{
+  SizeValueType numberOfRuns = 0;
+  for (const LineType & line : m_Lines)
+  {
+    numberOfRuns += line.size();
+  }
+  return numberOfRuns;
+}
+
+template <typename TPixel, unsigned int VImageDimension, typename TRunLength>
+void
+RunLengthImage<TPixel, VImageDimension, TRunLength>::CopyFromImage(const ImageType * image)
+{
+  this->CopyInformation(image);
+  this->SetBufferedRegion(image->GetBufferedRegion());
+  this->SetRequestedRegion(image->GetBufferedRegion());
+  this->Allocate();
+
+  const RegionType & bufferedRegion = this->GetBufferedRegion();
+  if (bufferedRegion.GetNumberOfPixels() == 0)
+  {
+    return;
+  }
+
+  for (ImageScanlineConstIterator it(image, bufferedRegion); !it.IsAtEnd(); it.NextLine())
+  {
+    LineType & line = m_Lines[this->ComputeLineNumber(it.GetIndex())];
+    line.clear();
+
+    PixelType     value = it.Get();
+    SizeValueType numberOfPixels = 0;
+    for (; !it.IsAtEndOfLine(); ++it)
+    {
+      if (Math::NotExactlyEquals(it.Get(), value))
+      {
+        AppendRuns(line, numberOfPixels, value);
+        value = it.Get();
+        numberOfPixels = 0;
+      }
+      ++numberOfPixels;
+    }
+    AppendRuns(line, numberOfPixels, value);
+    line.shrink_to_fit();
+  }
+}
+
+template <typename TPixel, unsigned int VImageDimension, typename TRunLength>
+void
+RunLengthImage<TPixel, VImageDimension, TRunLength>::CopyToImage(ImageType * image) const
+{
+  image->CopyInformation(this);
+  image->SetBufferedRegion(this->GetBufferedRegion());
+  image->SetRequestedRegion(this->GetBufferedRegion());
+  image->Allocate();
+
+  const RegionType & bufferedRegion = this->GetBufferedRegion();
+  if (bufferedRegion.GetNumberOfPixels() == 0)
+  {
+    return;
+  }
+
+  for (ImageScanlineIterator it(image, bufferedRegion); !it.IsAtEnd(); it.NextLine())
+  {
+    for (const RunType & run : m_Lines[this->ComputeLineNumber(it.GetIndex())])
+    {
+      for (RunLengthType i = 0; i < run.RunLength; ++i)
+      {
+        it.Set(run.Value);
+        ++it;
+      }
+    }
+  }
+}
+
+template <typename TPixel, unsigned int VImageDimension, typename TRunLength>
+auto
+RunLengthImage<TPixel, VImageDimension, TRunLength>::ComputeLineNumber(const IndexType & index) const
+  -> SizeValueType
+{
+  const RegionType & bufferedRegion = this->GetBufferedRegion();
+
+  SizeValueType lineNumber = 0;
+  for (unsigned int i = VImageDimension - 1; i > 0; --i)
+  {
+    lineNumber =
+      lineNumber * bufferedRegion.GetSize(i) + static_cast<SizeValueType>(index[i] - bufferedRegion.GetIndex(i));
+  }
+  return lineNumber;
+}
+
+template <typename TPixel, unsigned int VImageDimension, typename TRunLength>
+auto
+RunLengthImage<TPixel, VImageDimension, TRunLength>::MakeUniformLine(SizeValueType lineLength, const PixelType & value)
+  -> LineType
+{
+  LineType line;
+  AppendRuns(line, lineLength, value);
+  return line;
+}
+
+template <typename TPixel, unsigned int VImageDimension, typename TRunLength>
+void
+RunLengthImage<TPixel, VImageDimension, TRunLength>::AppendRuns(LineType &        line,
+                                                                SizeValueType     numberOfPixels,
+                                                                const PixelType & value)
+{
+  constexpr SizeValueType maximumRunLength = NumericTraits<RunLengthType>::max();
+  for (; numberOfPixels > maximumRunLength; numberOfPixels -= maximumRunLength)
+  {
+    line.push_back(RunType{ static_cast<RunLengthType>(maximumRunLength), value });
+  }
+  if (numberOfPixels > 0)
+  {
+    line.push_back(RunType{ static_cast<RunLengthType>(numberOfPixels), value });
+  }
+}
+
+template <typename TPixel, unsigned int VImageDimension, typename TRunLength>
+void
+RunLengthImage<TPixel, VImageDimension, TRunLength>::PrintSelf(std::ostream & os, Indent indent) const
+{
+  Superclass::PrintSelf(os, indent);
+
+  os << indent << "NumberOfLines: " << m_Lines.size() << std::endl;
+  os << indent << "NumberOfRuns: " << this->GetNumberOfRuns() << std::endl;
+}
+} // end namespace itk
+
+#endif
@@ -0,0 +1,268 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkRunLengthImageConstIterator_h
+#define itkRunLengthImageConstIterator_h
+
+#include "itkImageRegionConstIterator.h"
+#include "itkImageScanlineConstIterator.h"
+
+#include <algorithm> // For min.
+
+namespace itk
+{
+template <typename TPixel, unsigned int VImageDimension, typename TRunLength>
+class RunLengthImage;
+
+/** \class ImageConstIterator
+ * \brief Specialization of ImageConstIterator for RunLengthImage, which walks
+ * a region decoding its runs line by line.
+ *
+ * This iterator has the interface of ImageScanlineConstIterator:
+ * the lines of the region are walked with operator++() and
+ * IsAtEndOfLine(), and NextLine() moves to the beginning of the next line.
+ * Moving along a line only counts down the pixels of the current run, so
+ * that the runs are decoded as they are walked. GetRemainingRunLength()
+ * allows to process a run at once.
+ *
+ * It is the base of the ImageScanlineConstIterator and
+ * ImageRegionConstIterator specializations for RunLengthImage, through
+ * which generic code walks a RunLengthImage. There is no writing iterator,
+ * as a RunLengthImage has no pixel buffer.
+ *
+ * \ingroup ImageIterators
+ * \ingroup ITKCommon
+ */
+template <typename TPixel, unsigned int VImageDimension, typename TRunLength>
+class ImageConstIterator<RunLengthImage<TPixel, VImageDimension, TRunLength>>
+{
+public:
+  /** Standard class type aliases. */
+  using Self = ImageConstIterator;
+  using ImageType = RunLengthImage<TPixel, VImageDimension, TRunLength>;
+  using PixelType = typename ImageType::PixelType;
+  using InternalPixelType = typename ImageType::InternalPixelType;
+  using IndexType = typename ImageType::IndexType;
+  using SizeType = typename ImageType::SizeType;
+  using OffsetType = typename ImageType::OffsetType;
+  using RegionType = typename ImageType::RegionType;
+  using LineType = typename ImageType::LineType;
+
+  /** There is no pixel container, nor pixel accessor. These aliases are only
+   * declared for the declarations of the generic iterators. */
+  using PixelContainer = void;
+  using PixelContainerPointer = void *;
+  using AccessorType = void;
+  using AccessorFunctorType = void;
+
+  static constexpr unsigned int ImageIteratorDimension = VImageDimension;
+
+  /** Default constructor. */
+  ImageConstIterator() = default;
+
+  /** Constructor establishes an iterator to walk a particular image and a
+   * particular region of that image, which must be inside its buffered
+   * region. Initializes the iterator at the begin of the region. */
+  ImageConstIterator(const ImageType * ptr, const RegionType & region)
+    : m_Image(ptr)
+    , m_Region(region)
+  {
+    this->GoToBegin();
+  }
+
+  /** Moves the iterator to the beginning of the region. */
+  void
+  GoToBegin()
+  {
+    m_Index = m_Region.GetIndex();
+    m_IsAtEnd = (m_Region.GetNumberOfPixels() == 0);
+    if (!m_IsAtEnd)
+    {
+      this->InitializeLine();
+    }
+  }
+
+  /** Tells whether the iterator is past the last line of the region. */
+  [[nodiscard]] bool
+  IsAtEnd() const
+  {
+    return m_IsAtEnd;
+  }
+
+  /** Tells whether the iterator is past the end of the current line. */
+  [[nodiscard]] bool
+  IsAtEndOfLine() const
+  {
+    return m_Index[0] >= m_EndOfLine;
+  }
+
+  /** Moves the iterator to the beginning of the next line of the region. */
+  void
+  NextLine()
+  {
+    m_Index[0] = m_Region.GetIndex(0);
+    for (unsigned int i = 1; i < ImageIteratorDimension; ++i)
+    {
+      if (++m_Index[i] < m_Region.GetIndex(i) + static_cast<IndexValueType>(m_Region.GetSize(i)))
+      {
+        this->InitializeLine();
+        return;
+      }
+      m_Index[i] = m_Region.GetIndex(i);
+    }
+    m_IsAtEnd = true;
+  }
+
+  /** Returns the value of the current pixel. */
+  [[nodiscard]] const PixelType &
+  Get() const
+  {
+    return (*m_Line)[m_RunIndex].Value;
+  }
+
+  /** Returns the value of the current pixel. */
+  [[nodiscard]] const PixelType &
+  Value() const
+  {
+    return (*m_Line)[m_RunIndex].Value;
+  }
+
+  /** Returns the number of pixels of the current run, from the current pixel
+   * to the end of the run or of the line, whichever comes first. */
+  [[nodiscard]] SizeValueType
+  GetRemainingRunLength() const
+  {
+    return std::min(m_RemainingRunLength, static_cast<SizeValueType>(m_EndOfLine - m_Index[0]));
+  }
+
+  /** Returns the index of the current pixel. */
+  [[nodiscard]] const IndexType &
+  GetIndex() const
+  {
+    return m_Index;
+  }
+
+  /** Returns the region walked by the iterator. */
+  [[nodiscard]] const RegionType &
+  GetRegion() const
+  {
+    return m_Region;
+  }
+
+  /** Returns the image walked by the iterator. */
+  [[nodiscard]] const ImageType *
+  GetImage() const
+  {
+    return m_Image;
+  }
+
+protected:
+  /** Moves the iterator to the next pixel of the current line. */
+  void
+  Increment()
+  {
+    ++m_Index[0];
+    if (--m_RemainingRunLength == 0 && m_Index[0] < m_EndOfLine)
+    {
+      ++m_RunIndex;
+      m_RemainingRunLength = (*m_Line)[m_RunIndex].RunLength;
+    }
+  }
+
+private:
+  /** Finds the run that contains the current pixel. */
+  void
+  InitializeLine()
+  {
+    m_Line = &m_Image->GetLine(m_Index);
+    m_EndOfLine = m_Region.GetIndex(0) + static_cast<IndexValueType>(m_Region.GetSize(0));
+
+    auto x = static_cast<SizeValueType>(m_Index[0] - m_Image->GetBufferedRegion().GetIndex(0));
+    m_RunIndex = 0;
+    while (x >= (*m_Line)[m_RunIndex].RunLength)
+    {
+      x -= (*m_Line)[m_RunIndex].RunLength;
+      ++m_RunIndex;
+    }
+    m_RemainingRunLength = (*m_Line)[m_RunIndex].RunLength - x;
+  }
+
+  const ImageType * m_Image{};
+  RegionType        m_Region{};
+  IndexType         m_Index{};
+  IndexValueType    m_EndOfLine{};
+  const LineType *  m_Line{};
+  size_t            m_RunIndex{};
+  SizeValueType     m_RemainingRunLength{};
+  bool              m_IsAtEnd{ true };
+};
+
+
+/** \class ImageScanlineConstIterator
+ * \brief Specialization of ImageScanlineConstIterator for RunLengthImage.
+ * \ingroup ITKCommon
+ */
+template <typename TPixel, unsigned int VImageDimension, typename TRunLength>
+class ImageScanlineConstIterator<RunLengthImage<TPixel, VImageDimension, TRunLength>>
+  : public ImageConstIterator<RunLengthImage<TPixel, VImageDimension, TRunLength>>
+{
+public:
+  using Self = ImageScanlineConstIterator;
+  using Superclass = ImageConstIterator<RunLengthImage<TPixel, VImageDimension, TRunLength>>;
+
+  using Superclass::Superclass;
+
+  /** Moves the iterator to the next pixel of the current line. */
+  Self &
+  operator++()
+  {
+    this->Increment();
+    return *this;
+  }
+};
+
+
+/** \class ImageRegionConstIterator
+ * \brief Specialization of ImageRegionConstIterator for RunLengthImage.
+ * \ingroup ITKCommon
+ */
+template <typename TPixel, unsigned int VImageDimension, typename TRunLength>
+class ImageRegionConstIterator<RunLengthImage<TPixel, VImageDimension, TRunLength>>
+  : public ImageConstIterator<RunLengthImage<TPixel, VImageDimension, TRunLength>>
+{
+public:
+  using Self = ImageRegionConstIterator;
+  using Superclass = ImageConstIterator<RunLengthImage<TPixel, VImageDimension, TRunLength>>;
+
+  using Superclass::Superclass;
+
+  /** Moves the iterator to the next pixel of the region, the fastest
+   * dimension first. */
+  Self &
+  operator++()
+  {
+    this->Increment();
+    if (this->IsAtEndOfLine())
+    {
+      this->NextLine();
+    }
+    return *this;
+  }
+};
+} // end namespace itk
+
+#endif
@@ -0,0 +1,161 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkTraceEventRecorder_h
+#define itkTraceEventRecorder_h
+
+#include "ITKCommonExport.h"
+#include "itkIntTypes.h"
+#include "itkSingletonMacro.h"
+#include <chrono>
+#include <string>
+
+namespace itk
+{
+
+struct TraceEventRecorderGlobals;
+
+/** \class TraceEventRecorder
+ * \brief Records what each thread does, for viewing in Perfetto or chrome://tracing.
+ *
+ * TraceEventRecorder collects timed events, each with a category, a name, the
+ * thread which executed it, and optionally a number of bytes, and writes them
+ * in the Trace Event JSON format, which may be opened in https://ui.perfetto.dev
+ * or chrome://tracing. Events are recorded for:
+ *
+ * - the GenerateOutputInformation, GenerateInputRequestedRegion and
+ *   GenerateData phases of each ProcessObject during a pipeline update;
+ * - each work unit of MultiThreaderBase::ParallelizeImageRegion() and
+ *   ParallelizeImageRegionRestrictDirection();
+ * - the reading and writing of images by ImageFileReader and ImageFileWriter;
+ * - the allocation of image buffers by ImportImageContainer.
+ *
+ * Recording is off by default, in which case each hook costs the load of a
+ * flag. It is turned on by setting the environment variable ITK_TRACE_FILE to
+ * the name of the file to write, which is then written when the program
+ * exits, or programmatically with SetEnabled() and WriteTraceFile(). Each
+ * thread records into its own buffer, so that recording does not serialize
+ * the threads.
+ *
+ * \sa TraceEventScope
+ * \sa TimeProbesCollectorBase
+ *
+ * \ingroup ITKSystemObjects
+ * \ingroup ITKCommon
+ */
+class ITKCommon_EXPORT TraceEventRecorder
+{
+public:
+  using ClockType = std::chrono::steady_clock;
+
+  /** Set/Get whether events are recorded. */
+  /** @ITKStartGrouping */
+  static void
+  SetEnabled(bool enabled);
+  static bool
+  GetEnabled();
+  /** @ITKEndGrouping */
+  /** Set/Get the name of the file written by WriteTraceFile(). Initialized
+   * from the ITK_TRACE_FILE environment variable. */
+  /** @ITKStartGrouping */
+  static void
+  SetFileName(const std::string & fileName);
+  static std::string
+  GetFileName();
+  /** @ITKEndGrouping */
+  /** Record an event which started at begin and ended at end. When
+   * numberOfBytes is not zero, it is recorded as an argument of the event. */
+  static void
+  RecordEvent(const char *          category,
+              const char *          name,
+              ClockType::time_point begin,
+              ClockType::time_point end,
+              SizeValueType         numberOfBytes = 0);
+
+  /** Get the number of events recorded so far. */
+  static SizeValueType
+  GetNumberOfEvents();
+
+  /** Discard the events recorded so far. */
+  static void
+  Clear();
+
+  /** Write the events recorded so far to the trace file, and discard them.
+   * Throws an ExceptionObject when the file cannot be written. */
+  static void
+  WriteTraceFile();
+
+private:
+  itkGetGlobalDeclarationMacro(TraceEventRecorderGlobals, PimplGlobals);
+  static TraceEventRecorderGlobals * m_PimplGlobals;
+};
+
+/** \class TraceEventScope
+ * \brief Records a TraceEventRecorder event spanning its own lifetime.
+ *
+ * The category and name must outlive the scope; string literals and
+ * LightObject::GetNameOfClass() are suitable.
+ *
+\code
+{
+  const TraceEventScope traceEvent("GenerateData", this->GetNameOfClass());
+  this->GenerateData();
+}
+\endcode
+ *
+ * \ingroup ITKSystemObjects
+ * \ingroup ITKCommon
+ */
+class TraceEventScope
+{
+public:
+  TraceEventScope(const char * category, const char * name, SizeValueType numberOfBytes = 0)
+    : m_Category(category)
+    , m_Name(name)
+    , m_NumberOfBytes(numberOfBytes)
+    , m_Enabled(TraceEventRecorder::GetEnabled())
+  {
+    if (m_Enabled)
+    {
+      m_Begin = TraceEventRecorder::ClockType::now();
+    }
+  }
+
+  ~TraceEventScope()
+  {
+    if (m_Enabled)
+    {
+      TraceEventRecorder::RecordEvent(
+        m_Category, m_Name, m_Begin, TraceEventRecorder::ClockType::now(), m_NumberOfBytes);
+    }
+  }
+
+  TraceEventScope(const TraceEventScope &) = delete;
+  TraceEventScope &
+  operator=(const TraceEventScope &) = delete;
+
+private:
+  const char *                              m_Category;
+  const char *                              m_Name;
+  SizeValueType                             m_NumberOfBytes;
+  bool                                      m_Enabled;
+  TraceEventRecorder::ClockType::time_point m_Begin{};
+};
+
+} // end namespace itk
+
+#endif
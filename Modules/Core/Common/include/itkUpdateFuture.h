@@ -0,0 +1,147 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkUpdateFuture_h
+#define itkUpdateFuture_h
+
+#include "ITKCommonExport.h"
+#include "itkSingletonMacro.h"
+#include <chrono>
+#include <future>
+#include <memory>
+
+namespace itk
+{
+
+class ProcessObject;
+struct UpdateFutureState;
+struct UpdateFutureGlobals;
+
+/** \class UpdateFuture
+ * \brief Handle on the asynchronous update of a pipeline.
+ *
+ * An UpdateFuture is returned by ProcessObject::UpdateAsync() and
+ * ProcessObject::UpdateLargestPossibleRegionAsync(). Like a
+ * <tt>std::shared_future</tt>, it may be waited for, and Get() rethrows the
+ * exception which ended the update, if any. Its copies refer to the same
+ * update.
+ *
+ * The progress of the update is the fraction of the ProcessObjects upstream
+ * of the updated one which have executed, taking into account the progress
+ * of those which are executing. An update which had nothing to execute has a
+ * progress of one once it is ready.
+ *
+ * Cancel() is cooperative: the ProcessObjects which are executing are
+ * aborted, as with ProcessObject::AbortGenerateDataOn(), and so are the ones
+ * which execute later, as soon as they report their progress. Get() then
+ * throws a ProcessAborted exception. A ProcessObject which does not report
+ * its progress runs to completion.
+ *
+ * The updates are run by a small number of dedicated threads, shared by all
+ * the pipelines, while the ProcessObjects keep executing their work units on
+ * the ITK thread pool. At most GetMaximumNumberOfConcurrentUpdates() updates
+ * run at a time; the others are queued. A pipeline must not be modified, nor
+ * updated otherwise, until its asynchronous update is ready.
+ *
+ * \sa ProcessObject::UpdateAsync()
+ *
+ * \ingroup ITKSystemObjects
+ * \ingroup DataProcessing
+ * \ingroup ITKCommon
+ */
+class ITKCommon_EXPORT UpdateFuture
+{
+public:
+  /** An UpdateFuture which does not refer to any update. */
+  UpdateFuture() = default;
+
+  /** Whether this refers to an update. */
+  [[nodiscard]] bool
+  IsValid() const
+  {
+    return m_Future.valid();
+  }
+
+  /** Whether the update has finished, successfully or not. */
+  [[nodiscard]] bool
+  IsReady() const
+  {
+    return m_Future.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+  }
+
+  /** Wait for the update to finish. */
+  void
+  Wait() const
+  {
+    m_Future.wait();
+  }
+
+  /** Wait for the update to finish, at most for the given duration. Returns
+   * whether it has finished. */
+  template <typename TRep, typename TPeriod>
+  bool
+  WaitFor(const std::chrono::duration<TRep, TPeriod> & duration) const
+  {
+    return m_Future.wait_for(duration) == std::future_status::ready;
+  }
+
+  /** Wait for the update to finish, and rethrow the exception which ended
+   * it, if any. */
+  void
+  Get() const
+  {
+    m_Future.get();
+  }
+
+  /** Progress of the update, between zero and one. */
+  [[nodiscard]] float
+  GetProgress() const;
+
+  /** Ask the update to stop. */
+  void
+  Cancel();
+
+  /** Whether Cancel() has been called. */
+  [[nodiscard]] bool
+  IsCancelled() const;
+
+  /** Set/Get the maximum number of updates which run at a time. Defaults to
+   * four. */
+  /** @ITKStartGrouping */
+  static void
+  SetMaximumNumberOfConcurrentUpdates(unsigned int maximumNumberOfConcurrentUpdates);
+  static unsigned int
+  GetMaximumNumberOfConcurrentUpdates();
+  /** @ITKEndGrouping */
+
+private:
+  friend class ProcessObject;
+
+  /** Queue the update of processObject. */
+  static UpdateFuture
+  Launch(ProcessObject * processObject, bool largestPossibleRegion);
+
+  itkGetGlobalDeclarationMacro(UpdateFutureGlobals, PimplGlobals);
+  static UpdateFutureGlobals * m_PimplGlobals;
+
+  std::shared_ptr<UpdateFutureState> m_State{};
+  std::shared_future<void>           m_Future{};
+};
+
+} // end namespace itk
+
+#endif
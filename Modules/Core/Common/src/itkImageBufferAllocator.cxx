@@ -0,0 +1,298 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#include "itkImageBufferAllocator.h"
+#include "itkSingleton.h"
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <new>
+
+#ifdef __linux__
+#  include <sys/mman.h>
+#endif
+
+namespace itk
+{
+
+struct ImageBufferAllocatorGlobals
+{
+  struct BufferRecord
+  {
+    ImageBufferAllocator::Pointer Allocator;
+    size_t                        NumberOfBytes{ 0 };
+  };
+
+  std::mutex                               m_Mutex{};
+  ImageBufferAllocator::Pointer            m_GlobalAllocator{};
+  std::unordered_map<void *, BufferRecord> m_Buffers{};
+  std::atomic<size_t>                      m_NumberOfBuffers{ 0 };
+};
+
+itkGetGlobalSimpleMacro(ImageBufferAllocator, ImageBufferAllocatorGlobals, PimplGlobals);
+ImageBufferAllocatorGlobals * ImageBufferAllocator::m_PimplGlobals;
+
+ImageBufferAllocator::~ImageBufferAllocator() { this->ReleasePool(); }
+
+size_t
+ImageBufferAllocator::GetBucketSize(size_t numberOfBytes)
+{
+  // Small buffers are rounded up to the alignment, medium ones to a page, and
+  // large ones to a huge page. Large buffers are reserved rather than touched,
+  // so the rounding costs address space rather than memory.
+  constexpr size_t pageSize = 4096;
+  const size_t     granularity =
+    numberOfBytes >= HugePageSize ? HugePageSize : (numberOfBytes >= pageSize ? pageSize : Alignment);
+  return std::max(granularity, (numberOfBytes + granularity - 1) / granularity * granularity);
+}
+
+void *
+ImageBufferAllocator::AllocateFromSystem(size_t bucketSize) const
+{
+  const size_t alignment = bucketSize >= HugePageSize ? HugePageSize : Alignment;
+  void *       buffer = ::operator new(bucketSize, std::align_val_t{ alignment }, std::nothrow);
+  if (buffer == nullptr)
+  {
+    // We cannot construct an error string here because we may be out
+    // of memory.  Do not use the exception macro.
+    throw MemoryAllocationError(__FILE__, __LINE__, "Failed to allocate memory for image.", ITK_LOCATION);
+  }
+#ifdef __linux__
+#  ifdef MADV_HUGEPAGE
+  if (bucketSize >= HugePageSize && m_UseTransparentHugePages)
+  {
+    // Only a hint: the buffer is still usable when it is not honored.
+    madvise(buffer, bucketSize, MADV_HUGEPAGE);
+  }
+#  endif
+#endif
+  return buffer;
+}
+
+void
+ImageBufferAllocator::DeallocateToSystem(void * buffer, size_t bucketSize)
+{
+  const size_t alignment = bucketSize >= HugePageSize ? HugePageSize : Alignment;
+  ::operator delete(buffer, std::align_val_t{ alignment });
+}
+
+void *
+ImageBufferAllocator::Allocate(size_t numberOfBytes)
+{
+  const size_t bucketSize = GetBucketSize(numberOfBytes);
+  {
+    const std::lock_guard<std::mutex> lockGuard(m_Mutex);
+    ++m_NumberOfAllocations;
+    m_AllocatedBytes += bucketSize;
+    m_PeakAllocatedBytes = std::max(m_PeakAllocatedBytes, m_AllocatedBytes);
+
+    const auto bucket = m_Pool.find(bucketSize);
+    if (bucket != m_Pool.end() && !bucket->second.empty())
+    {
+      void * buffer = bucket->second.back();
+      bucket->second.pop_back();
+      m_PooledBytes -= bucketSize;
+      ++m_NumberOfPoolHits;
+      return buffer;
+    }
+  }
+
+  try
+  {
+    return this->AllocateFromSystem(bucketSize);
+  }
+  catch (...)
+  {
+    const std::lock_guard<std::mutex> lockGuard(m_Mutex);
+    m_AllocatedBytes -= bucketSize;
+    throw;
+  }
+}
+
+void
+ImageBufferAllocator::Deallocate(void * buffer, size_t numberOfBytes)
+{
+  if (buffer == nullptr)
+  {
+    return;
+  }
+  const size_t bucketSize = GetBucketSize(numberOfBytes);
+  {
+    const std::lock_guard<std::mutex> lockGuard(m_Mutex);
+    m_AllocatedBytes -= bucketSize;
+    if (m_PooledBytes + bucketSize <= m_PoolCapacity)
+    {
+      m_Pool[bucketSize].push_back(buffer);
+      m_PooledBytes += bucketSize;
+      return;
+    }
+  }
+  DeallocateToSystem(buffer, bucketSize);
+}
+
+void
+ImageBufferAllocator::ReleasePool()
+{
+  this->TrimPool(0);
+}
+
+void
+ImageBufferAllocator::SetPoolCapacity(SizeValueType poolCapacity)
+{
+  if (m_PoolCapacity != poolCapacity)
+  {
+    m_PoolCapacity = poolCapacity;
+    this->TrimPool(poolCapacity);
+    this->Modified();
+  }
+}
+
+void
+ImageBufferAllocator::TrimPool(SizeValueType poolCapacity)
+{
+  std::vector<std::pair<void *, size_t>> released;
+  {
+    const std::lock_guard<std::mutex> lockGuard(m_Mutex);
+    for (auto & bucket : m_Pool)
+    {
+      while (m_PooledBytes > poolCapacity && !bucket.second.empty())
+      {
+        released.emplace_back(bucket.second.back(), bucket.first);
+        bucket.second.pop_back();
+        m_PooledBytes -= bucket.first;
+      }
+    }
+  }
+  for (const auto & buffer : released)
+  {
+    DeallocateToSystem(buffer.first, buffer.second);
+  }
+}
+
+SizeValueType
+ImageBufferAllocator::GetNumberOfAllocations() const
+{
+  const std::lock_guard<std::mutex> lockGuard(m_Mutex);
+  return m_NumberOfAllocations;
+}
+
+SizeValueType
+ImageBufferAllocator::GetNumberOfPoolHits() const
+{
+  const std::lock_guard<std::mutex> lockGuard(m_Mutex);
+  return m_NumberOfPoolHits;
+}
+
+SizeValueType
+ImageBufferAllocator::GetAllocatedBytes() const
+{
+  const std::lock_guard<std::mutex> lockGuard(m_Mutex);
+  return m_AllocatedBytes;
+}
+
+SizeValueType
+ImageBufferAllocator::GetPeakAllocatedBytes() const
+{
+  const std::lock_guard<std::mutex> lockGuard(m_Mutex);
+  return m_PeakAllocatedBytes;
+}
+
+SizeValueType
+ImageBufferAllocator::GetPooledBytes() const
+{
+  const std::lock_guard<std::mutex> lockGuard(m_Mutex);
+  return m_PooledBytes;
+}
+
+void
+ImageBufferAllocator::SetGlobalAllocator(Self * allocator)
+{
+  itkInitGlobalsMacro(PimplGlobals);
+  const std::lock_guard<std::mutex> lockGuard(m_PimplGlobals->m_Mutex);
+  m_PimplGlobals->m_GlobalAllocator = allocator;
+}
+
+auto
+ImageBufferAllocator::GetGlobalAllocator() -> Pointer
+{
+  itkInitGlobalsMacro(PimplGlobals);
+  const std::lock_guard<std::mutex> lockGuard(m_PimplGlobals->m_Mutex);
+  return m_PimplGlobals->m_GlobalAllocator;
+}
+
+void *
+ImageBufferAllocator::AllocateGlobal(size_t numberOfBytes, bool zeroFill)
+{
+  const Pointer allocator = GetGlobalAllocator();
+  if (allocator.IsNull())
+  {
+    return nullptr;
+  }
+
+  void * buffer = allocator->Allocate(numberOfBytes);
+  if (zeroFill)
+  {
+    std::memset(buffer, 0, numberOfBytes);
+  }
+
+  const std::lock_guard<std::mutex> lockGuard(m_PimplGlobals->m_Mutex);
+  m_PimplGlobals->m_Buffers[buffer] = { allocator, numberOfBytes };
+  ++m_PimplGlobals->m_NumberOfBuffers;
+  return buffer;
+}
+
+bool
+ImageBufferAllocator::DeallocateGlobal(void * buffer)
+{
+  itkInitGlobalsMacro(PimplGlobals);
+  // Without any allocator in use, every buffer comes from new[].
+  if (buffer == nullptr || m_PimplGlobals->m_NumberOfBuffers == 0)
+  {
+    return false;
+  }
+
+  ImageBufferAllocatorGlobals::BufferRecord record;
+  {
+    const std::lock_guard<std::mutex> lockGuard(m_PimplGlobals->m_Mutex);
+    const auto                        it = m_PimplGlobals->m_Buffers.find(buffer);
+    if (it == m_PimplGlobals->m_Buffers.end())
+    {
+      return false;
+    }
+    record = std::move(it->second);
+    m_PimplGlobals->m_Buffers.erase(it);
+    --m_PimplGlobals->m_NumberOfBuffers;
+  }
+  record.Allocator->Deallocate(buffer, record.NumberOfBytes);
+  return true;
+}
+
+void
+ImageBufferAllocator::PrintSelf(std::ostream & os, Indent indent) const
+{
+  Superclass::PrintSelf(os, indent);
+
+  os << indent << "PoolCapacity: " << m_PoolCapacity << std::endl;
+  itkPrintSelfBooleanMacro(UseTransparentHugePages);
+  os << indent << "NumberOfAllocations: " << this->GetNumberOfAllocations() << std::endl;
+  os << indent << "NumberOfPoolHits: " << this->GetNumberOfPoolHits() << std::endl;
+  os << indent << "AllocatedBytes: " << this->GetAllocatedBytes() << std::endl;
+  os << indent << "PeakAllocatedBytes: " << this->GetPeakAllocatedBytes() << std::endl;
+  os << indent << "PooledBytes: " << this->GetPooledBytes() << std::endl;
+}
+
+} // end namespace itk
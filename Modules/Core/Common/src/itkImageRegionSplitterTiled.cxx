@@ -0,0 +1,158 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkImageRegionSplitterTiled.h"
+
+namespace itk
+{
+
+ImageRegionSplitterTiled::ImageRegionSplitterTiled() = default;
+
+void
+ImageRegionSplitterTiled::PrintSelf(std::ostream & os, Indent indent) const
+{
+  Superclass::PrintSelf(os, indent);
+
+  os << indent << "CacheSize: " << m_CacheSize << std::endl;
+  os << indent << "BytesPerPixel: " << m_BytesPerPixel << std::endl;
+  os << indent << "KernelRadius: " << m_KernelRadius << std::endl;
+}
+
+unsigned int
+ImageRegionSplitterTiled::GetNumberOfSplitsInternal(unsigned int         dim,
+                                                    const IndexValueType itkNotUsed(regionIndex)[],
+                                                    const SizeValueType  regionSize[],
+                                                    unsigned int         requestedNumber) const
+{
+  // number of splits in each dimension
+  std::vector<unsigned int> splits(dim);
+
+  return this->ComputeSplits(dim, requestedNumber, regionSize, splits.data());
+}
+
+unsigned int
+ImageRegionSplitterTiled::GetSplitInternal(unsigned int   dim,
+                                           unsigned int   splitI,
+                                           unsigned int   numberOfPieces,
+                                           IndexValueType regionIndex[],
+                                           SizeValueType  regionSize[]) const
+{
+  // number of splits in each dimension
+  std::vector<unsigned int> splits(dim);
+
+  numberOfPieces = this->ComputeSplits(dim, numberOfPieces, regionSize, splits.data());
+
+  // Assign the tile to the input region in-place, the tiles being ordered
+  // with the fastest dimension first
+  unsigned int offset = splitI;
+  for (unsigned int i = 0; i < dim; ++i)
+  {
+    const unsigned int  tileIndex = offset % splits[i];
+    const SizeValueType inputRegionSize = regionSize[i];
+    offset /= splits[i];
+
+    const auto indexOffset =
+      Math::Floor<IndexValueType>(tileIndex * (inputRegionSize / static_cast<double>(splits[i])));
+    regionIndex[i] += indexOffset;
+    if (tileIndex < splits[i] - 1)
+    {
+      regionSize[i] =
+        Math::Floor<SizeValueType>((tileIndex + 1) * (inputRegionSize / static_cast<double>(splits[i]))) -
+        indexOffset;
+    }
+    else
+    {
+      regionSize[i] = inputRegionSize - indexOffset;
+    }
+  }
+
+  return numberOfPieces;
+}
+
+unsigned int
+ImageRegionSplitterTiled::ComputeSplits(unsigned int        dim,
+                                        unsigned int        requestedNumber,
+                                        const SizeValueType regionSize[],
+                                        unsigned int        splits[]) const
+{
+  const double padding = 2.0 * static_cast<double>(m_KernelRadius);
+
+  // size of each tile
+  std::vector<double> tileSize(dim);
+  unsigned int        numberOfPieces = 1;
+  for (unsigned int i = 0; i < dim; ++i)
+  {
+    splits[i] = 1;
+    tileSize[i] = regionSize[i];
+  }
+
+  while (true)
+  {
+    // The rows are only cut when even the thinnest tile made of whole rows
+    // would not fit in the cache.
+    double rowTileFootprint = static_cast<double>(m_BytesPerPixel) * (tileSize[0] + padding);
+    for (unsigned int i = 1; i < dim; ++i)
+    {
+      rowTileFootprint *= 1.0 + padding;
+    }
+    const bool splitRows = rowTileFootprint > static_cast<double>(m_CacheSize);
+
+    // find the splittable dimension with the largest tile size, preferring
+    // the slower dimensions
+    unsigned int splitDim = dim;
+    for (unsigned int i = (splitRows ? 0 : 1); i < dim; ++i)
+    {
+      if (splits[i] < regionSize[i] && (splitDim == dim || tileSize[i] >= tileSize[splitDim]))
+      {
+        splitDim = i;
+      }
+    }
+    if (splitDim == dim)
+    {
+      if (!splitRows && splits[0] < regionSize[0])
+      {
+        // all the other dimensions are split to single pixels
+        splitDim = 0;
+      }
+      else
+      {
+        return numberOfPieces;
+      }
+    }
+
+    // calculate the number of additional pieces this split would add
+    unsigned int additionalNumPieces = 1;
+    for (unsigned int i = 0; i < dim; ++i)
+    {
+      if (i != splitDim)
+      {
+        additionalNumPieces *= splits[i];
+      }
+    }
+    if (numberOfPieces + additionalNumPieces > requestedNumber)
+    {
+      return numberOfPieces;
+    }
+
+    numberOfPieces += additionalNumPieces;
+    ++splits[splitDim];
+    tileSize[splitDim] = regionSize[splitDim] / static_cast<double>(splits[splitDim]);
+  }
+}
+
+} // end namespace itk
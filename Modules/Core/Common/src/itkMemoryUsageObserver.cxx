@@ -16,6 +16,7 @@
  *
  *=========================================================================*/
 #include "itkMemoryUsageObserver.h"
+#include "itkImageBufferAllocator.h"
 
 #if defined(WIN32) || defined(_WIN32)
 #  include <windows.h>
@@ -474,6 +475,20 @@ MallinfoMemoryUsageObserver::GetMemoryUsage()
 
 #endif // Unix and Mac Platforms !defined(WIN32) && !defined(_WIN32)
 
+/**         ----         Image Buffer Allocator Memory Usage Observer       ----       */
+
+ImageBufferAllocatorMemoryUsageObserver::~ImageBufferAllocatorMemoryUsageObserver() = default;
+
+MemoryUsageObserverBase::MemoryLoadType
+ImageBufferAllocatorMemoryUsageObserver::GetMemoryUsage()
+{
+  const ImageBufferAllocator::Pointer allocator = ImageBufferAllocator::GetGlobalAllocator();
+  if (allocator.IsNull())
+  {
+    return 0;
+  }
+  return static_cast<MemoryLoadType>((allocator->GetAllocatedBytes() + allocator->GetPooledBytes()) / 1024);
+}
 
 // Destructor for MemoryUsageObserver
 MemoryUsageObserver::~MemoryUsageObserver() = default;
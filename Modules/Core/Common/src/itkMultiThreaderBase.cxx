@@ -262,6 +262,26 @@ MultiThreaderBase::SetUpdateProgress(bool updates)
   this->m_UpdateProgress = updates;
 }
 
+void
+MultiThreaderBase::SetImageRegionSplitter(const ImageRegionSplitterBase * splitter)
+{
+  if (m_ImageRegionSplitter != splitter)
+  {
+    m_ImageRegionSplitter = splitter;
+    this->Modified();
+  }
+}
+
+const ImageRegionSplitterBase *
+MultiThreaderBase::GetImageRegionSplitter() const
+{
+  if (m_ImageRegionSplitter)
+  {
+    return m_ImageRegionSplitter;
+  }
+  return ImageSourceCommon::GetGlobalDefaultSplitter();
+}
+
 ThreadIdType
 MultiThreaderBase::GetGlobalDefaultNumberOfThreads()
 {
@@ -536,7 +556,7 @@ MultiThreaderBase::ParallelizeImageRegion(unsigned int
   }
   const ProgressReporter progress(filter, 0, 1);
 
-  struct RegionAndCallback rnc{ funcP, dimension, index, size, filter };
+  struct RegionAndCallback rnc{ funcP, dimension, index, size, filter, this->GetImageRegionSplitter() };
   this->SetSingleMethodAndExecute(&MultiThreaderBase::ParallelizeImageRegionHelper, &rnc);
 }
 
@@ -548,7 +568,7 @@ MultiThreaderBase::ParallelizeImageRegionHelper(void * arg)
   const ThreadIdType workUnitCount = workUnitInfo->NumberOfWorkUnits;
   auto *             rnc = static_cast<struct RegionAndCallback *>(workUnitInfo->UserData);
 
-  const ImageRegionSplitterBase * splitter = ImageSourceCommon::GetGlobalDefaultSplitter();
+  const ImageRegionSplitterBase * splitter = rnc->splitter;
   ImageIORegion                   region(rnc->dimension);
   for (unsigned int d = 0; d < rnc->dimension; ++d)
   {
@@ -577,6 +597,9 @@ MultiThreaderBase::PrintSelf(std::ostream & os, Indent indent) const
 
   os << indent << "Number of Work Units: " << m_NumberOfWorkUnits << '\n';
   os << indent << "Number of Threads: " << m_MaximumNumberOfThreads << '\n';
+  os << indent << "OverDecomposition: " << m_OverDecomposition << '\n';
+  itkPrintSelfBooleanMacro(AutoTuneOverDecomposition);
+  itkPrintSelfObjectMacro(ImageRegionSplitter);
   os << indent << "Global Maximum Number Of Threads: " << m_PimplGlobals->m_GlobalMaximumNumberOfThreads << std::endl;
   os << indent << "Global Default Number Of Threads: " << m_PimplGlobals->m_GlobalDefaultNumberOfThreads << std::endl;
   os << indent << "Global Default Threader Type: " << m_PimplGlobals->m_GlobalDefaultThreader << std::endl;
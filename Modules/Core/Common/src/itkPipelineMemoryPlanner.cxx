@@ -0,0 +1,197 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#include "itkPipelineMemoryPlanner.h"
+#include "itkImageBufferAllocator.h"
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <set>
+
+namespace itk
+{
+
+void
+PipelineMemoryPlanner::AddPersistentDataObject(const DataObject * dataObject)
+{
+  if (dataObject != nullptr && std::find(m_PersistentDataObjects.begin(), m_PersistentDataObjects.end(), dataObject) ==
+                                 m_PersistentDataObjects.end())
+  {
+    m_PersistentDataObjects.push_back(dataObject);
+    this->Modified();
+  }
+}
+
+void
+PipelineMemoryPlanner::ClearPersistentDataObjects()
+{
+  if (!m_PersistentDataObjects.empty())
+  {
+    m_PersistentDataObjects.clear();
+    this->Modified();
+  }
+}
+
+void
+PipelineMemoryPlanner::Update()
+{
+  if (m_Output.IsNull())
+  {
+    itkExceptionMacro("Output is not set.");
+  }
+
+  // Find the ProcessObjects reachable upstream from the output, and the
+  // distinct inputs of each of them.
+  std::vector<ProcessObject *>                      processObjects;
+  std::map<ProcessObject *, std::set<DataObject *>> inputsOf;
+  std::map<DataObject *, SizeValueType>             numberOfConsumers;
+  std::vector<ProcessObject *>                      toVisit;
+  if (ProcessObject * source = m_Output->GetSource())
+  {
+    toVisit.push_back(source);
+  }
+  while (!toVisit.empty())
+  {
+    ProcessObject * processObject = toVisit.back();
+    toVisit.pop_back();
+    if (inputsOf.count(processObject) > 0)
+    {
+      continue;
+    }
+    processObjects.push_back(processObject);
+    auto & inputs = inputsOf[processObject];
+    for (const auto & input : processObject->GetInputs())
+    {
+      if (input.IsNotNull() && inputs.insert(input.GetPointer()).second)
+      {
+        ++numberOfConsumers[input.GetPointer()];
+        if (ProcessObject * inputSource = input->GetSource())
+        {
+          toVisit.push_back(inputSource);
+        }
+      }
+    }
+  }
+
+  const auto isIntermediate = [this](const DataObject * dataObject) {
+    return dataObject != m_Output.GetPointer() && dataObject->GetSource() != nullptr &&
+           std::find(m_PersistentDataObjects.begin(), m_PersistentDataObjects.end(), dataObject) ==
+             m_PersistentDataObjects.end();
+  };
+
+  // Allow in-place execution only where the overwritten input is not needed
+  // by anything else.
+  std::vector<std::pair<ProcessObject *, bool>> inPlaceSettings;
+  std::set<const ProcessObject *>               runsInPlace;
+  for (ProcessObject * processObject : processObjects)
+  {
+    if (!m_PlanInPlaceExecution || !processObject->SupportsInPlace())
+    {
+      continue;
+    }
+    const auto & inputs = inputsOf[processObject];
+    const bool   inPlace = !inputs.empty() && std::all_of(inputs.begin(), inputs.end(), [&](DataObject * input) {
+      return isIntermediate(input) && numberOfConsumers[input] == 1;
+    });
+    inPlaceSettings.emplace_back(processObject, processObject->GetInPlaceExecution());
+    processObject->SetInPlaceExecution(inPlace);
+    if (inPlace)
+    {
+      runsInPlace.insert(processObject);
+    }
+  }
+
+  // Release each intermediate input once its last consumer has executed. The
+  // count is rearmed, so that a pipeline streamed by a downstream filter
+  // releases its intermediate results after each piece.
+  m_Schedule.clear();
+  m_PeakAllocatedBytes = 0;
+  const ImageBufferAllocator::Pointer allocator = ImageBufferAllocator::GetGlobalAllocator();
+  std::map<DataObject *, SizeValueType> remainingConsumers = numberOfConsumers;
+
+  // Branches updated concurrently (see ProcessObject::SetUpdateInputsConcurrently())
+  // end in several threads.
+  std::mutex                                             scheduleMutex;
+  std::vector<std::pair<ProcessObject *, unsigned long>> observers;
+  for (ProcessObject * processObject : processObjects)
+  {
+    const auto endCommand = [&, processObject](const EventObject &) {
+      const std::lock_guard<std::mutex> lockGuard(scheduleMutex);
+      ScheduleStep                      step;
+      step.ProcessObjectName = processObject->GetNameOfClass();
+      step.InPlace = runsInPlace.count(processObject) > 0;
+      if (allocator.IsNotNull())
+      {
+        step.AllocatedBytes = allocator->GetAllocatedBytes();
+        m_PeakAllocatedBytes = std::max(m_PeakAllocatedBytes, step.AllocatedBytes);
+      }
+      for (DataObject * input : inputsOf[processObject])
+      {
+        if (isIntermediate(input) && --remainingConsumers[input] == 0)
+        {
+          input->ReleaseData();
+          remainingConsumers[input] = numberOfConsumers[input];
+          ++step.NumberOfReleasedDataObjects;
+        }
+      }
+      m_Schedule.push_back(step);
+    };
+    observers.emplace_back(processObject, processObject->AddObserver(EndEvent(), endCommand));
+  }
+
+  const auto restorePipeline = [&observers, &inPlaceSettings]() {
+    for (const auto & observer : observers)
+    {
+      observer.first->RemoveObserver(observer.second);
+    }
+    for (const auto & inPlaceSetting : inPlaceSettings)
+    {
+      inPlaceSetting.first->SetInPlaceExecution(inPlaceSetting.second);
+    }
+  };
+
+  try
+  {
+    m_Output->Update();
+  }
+  catch (...)
+  {
+    restorePipeline();
+    throw;
+  }
+  restorePipeline();
+}
+
+void
+PipelineMemoryPlanner::PrintSelf(std::ostream & os, Indent indent) const
+{
+  Superclass::PrintSelf(os, indent);
+
+  itkPrintSelfObjectMacro(Output);
+  os << indent << "NumberOfPersistentDataObjects: " << m_PersistentDataObjects.size() << std::endl;
+  itkPrintSelfBooleanMacro(PlanInPlaceExecution);
+  os << indent << "Schedule: " << std::endl;
+  for (const auto & step : m_Schedule)
+  {
+    os << indent.GetNextIndent() << step.ProcessObjectName << (step.InPlace ? " (in place)" : "")
+       << ", released: " << step.NumberOfReleasedDataObjects << ", allocated bytes: " << step.AllocatedBytes
+       << std::endl;
+  }
+  os << indent << "PeakAllocatedBytes: " << m_PeakAllocatedBytes << std::endl;
+}
+
+} // end namespace itk
@@ -28,10 +28,11 @@
 #include "itkPoolMultiThreader.h"
 #include "itkNumericTraits.h"
 #include "itkProcessObject.h"
-#include "itkImageSourceCommon.h"
+#include "itkTotalProgressReporter.h"
 #include <algorithm>
 #include <exception>
 #include <iostream>
+#include <numeric>
 #include <string>
 
 namespace itk
@@ -40,6 +41,16 @@ namespace
 {
 std::chrono::milliseconds threadCompletionPollingInterval = std::chrono::milliseconds(10);
 
+// Pieces shorter than this spend a noticeable part of their time being
+// scheduled, so auto-tuning makes them larger.
+constexpr std::chrono::microseconds minimumAutoTunedPieceTime{ 100 };
+
+// Auto-tuning makes the pieces smaller when the busiest thread works this
+// much longer than the average one.
+constexpr double maximumAutoTunedImbalance = 1.25;
+
+constexpr unsigned int maximumAutoTunedOverDecomposition = 64;
+
 class ExceptionHandler
 {
 public:
@@ -250,9 +261,13 @@ PoolMultiThreader::ParallelizeImageRegion(unsigned int         dimension,
     {
       funcP(index, size); // process whole region
     }
+    else if (m_OverDecomposition > 1 || m_AutoTuneOverDecomposition)
+    {
+      this->ParallelizeOverDecomposedImageRegion(region, funcP, filter);
+    }
     else
     {
-      const ImageRegionSplitterBase * splitter = ImageSourceCommon::GetGlobalDefaultSplitter();
+      const ImageRegionSplitterBase * splitter = this->GetImageRegionSplitter();
       const ThreadIdType              splitCount = splitter->GetNumberOfSplits(region, m_NumberOfWorkUnits);
       ProgressReporter                reporter(filter, 0, splitCount);
       itkAssertOrThrowMacro(splitCount <= m_NumberOfWorkUnits, "Split count is greater than number of work units!");
@@ -306,6 +321,82 @@ PoolMultiThreader::ParallelizeImageRegion(unsigned int         dimension,
   }
 }
 
+void
+PoolMultiThreader::ParallelizeOverDecomposedImageRegion(const ImageIORegion &        region,
+                                                        const ThreadingFunctorType & funcP,
+                                                        ProcessObject *              filter)
+{
+  using ClockType = std::chrono::steady_clock;
+
+  const ImageRegionSplitterBase * splitter = this->GetImageRegionSplitter();
+  const auto                      requestedNumberOfPieces = static_cast<unsigned int>(
+    std::min<uint64_t>(uint64_t{ m_NumberOfWorkUnits } * m_OverDecomposition, NumericTraits<unsigned int>::max()));
+  const unsigned int numberOfPieces = splitter->GetNumberOfSplits(region, requestedNumberOfPieces);
+  const unsigned int numberOfTasks =
+    std::min({ numberOfPieces, m_NumberOfWorkUnits, std::max(m_MaximumNumberOfThreads, ThreadIdType{ 1 }) });
+  const SizeValueType numberOfPixels = region.GetNumberOfPixels();
+
+  // Each task, this thread being the first one, processes the next piece
+  // left until none is.
+  std::atomic<unsigned int>        nextPiece{ 0 };
+  std::vector<ClockType::duration> busyTimes(numberOfTasks, ClockType::duration::zero());
+  const auto processPieces = [&](unsigned int task) {
+    TotalProgressReporter reporter(filter, numberOfPixels);
+    for (unsigned int piece = nextPiece++; piece < numberOfPieces; piece = nextPiece++)
+    {
+      ImageIORegion pieceRegion = region;
+      splitter->GetSplit(piece, numberOfPieces, pieceRegion);
+
+      const ClockType::time_point start = ClockType::now();
+      funcP(&pieceRegion.GetIndex()[0], &pieceRegion.GetSize()[0]);
+      busyTimes[task] += ClockType::now() - start;
+
+      reporter.Completed(pieceRegion.GetNumberOfPixels());
+    }
+  };
+
+  std::vector<std::future<void>> futures;
+  for (unsigned int task = 1; task < numberOfTasks; ++task)
+  {
+    futures.push_back(m_ThreadPool->AddWork(processPieces, task));
+  }
+
+  ExceptionHandler exceptionHandler;
+  exceptionHandler.TryAndCatch([&processPieces] { processPieces(0); });
+  for (auto & future : futures)
+  {
+    exceptionHandler.TryAndCatch([&future, filter] {
+      while (future.wait_for(threadCompletionPollingInterval) == std::future_status::timeout)
+      {
+        if (filter)
+        {
+          filter->IncrementProgress(0);
+        }
+      }
+      future.get();
+    });
+  }
+
+  if (m_AutoTuneOverDecomposition)
+  {
+    const ClockType::duration totalBusyTime =
+      std::accumulate(busyTimes.cbegin(), busyTimes.cend(), ClockType::duration::zero());
+    const ClockType::duration maximumBusyTime = *std::max_element(busyTimes.cbegin(), busyTimes.cend());
+
+    if (totalBusyTime < numberOfPieces * ClockType::duration(minimumAutoTunedPieceTime))
+    {
+      m_OverDecomposition = std::max(m_OverDecomposition / 2, 1u);
+    }
+    else if (numberOfPieces == requestedNumberOfPieces &&
+             maximumBusyTime.count() * numberOfTasks > maximumAutoTunedImbalance * totalBusyTime.count())
+    {
+      m_OverDecomposition = std::min(2 * m_OverDecomposition, maximumAutoTunedOverDecomposition);
+    }
+  }
+
+  exceptionHandler.RethrowFirstCaughtException();
+}
+
 void
 PoolMultiThreader::PrintSelf(std::ostream & os, Indent indent) const
 {
@@ -31,7 +31,9 @@
 #include <cstdio>
 #include <sstream>
 #include <algorithm>
+#include <exception>
 #include "itkMultiThreaderBase.h"
+#include "itkTraceEventRecorder.h"
 
 namespace itk
 {
@@ -1261,6 +1263,7 @@ ProcessObject::PrintSelf(std::ostream & os, Indent indent) const
   os << indent << "NumberOfRequiredOutputs: " << m_NumberOfRequiredOutputs << std::endl;
   os << indent << "NumberOfWorkUnits: " << m_NumberOfWorkUnits << std::endl;
   itkPrintSelfBooleanMacro(ReleaseDataBeforeUpdateFlag);
+  itkPrintSelfBooleanMacro(UpdateInputsConcurrently);
   itkPrintSelfBooleanMacro(AbortGenerateData);
   os << indent << "Progress: " << progressFixedToFloat(m_Progress) << std::endl;
   os << indent << "Multithreader: " << std::endl;
@@ -1451,7 +1454,10 @@ ProcessObject::UpdateOutputInformation()
     /**
      * Finally, generate the output information.
      */
-    this->GenerateOutputInformation();
+    {
+      const TraceEventScope traceEvent("GenerateOutputInformation", this->GetNameOfClass());
+      this->GenerateOutputInformation();
+    }
 
     /**
      * Keep track of the last time GenerateOutputInformation() was called
@@ -1498,7 +1504,10 @@ ProcessObject::PropagateRequestedRegion(DataObject * output)
    * derives a new pixel value by applying some operation to a
    * neighborhood of surrounding original values.
    */
-  this->GenerateInputRequestedRegion();
+  {
+    const TraceEventScope traceEvent("GenerateInputRequestedRegion", this->GetNameOfClass());
+    this->GenerateInputRequestedRegion();
+  }
 
   /**
    * Now that we know the input requested region, propagate this
@@ -1645,6 +1654,53 @@ ProcessObject::UpdateOutputData(DataObject * itkNotUsed(output))
       this->GetPrimaryInput()->UpdateOutputData();
     }
   }
+  else if (m_UpdateInputsConcurrently && this->InputBranchesAreIndependent())
+  {
+    // The branches do not lead back to the same data object, so all the
+    // requested regions may be propagated before updating any of them.
+    std::vector<DataObject *> inputs;
+    for (auto & input : m_Inputs)
+    {
+      if (input.second)
+      {
+        input.second->PropagateRequestedRegion();
+        inputs.push_back(input.second);
+      }
+    }
+
+    // Update the first branch in this thread, and each other one in its own.
+    std::vector<std::exception_ptr> exceptions(inputs.size());
+    const auto                      updateBranch = [&inputs, &exceptions](size_t branch) {
+      try
+      {
+        inputs[branch]->UpdateOutputData();
+      }
+      catch (...)
+      {
+        exceptions[branch] = std::current_exception();
+      }
+    };
+    std::vector<std::thread> threads;
+    for (size_t branch = 1; branch < inputs.size(); ++branch)
+    {
+      threads.emplace_back(updateBranch, branch);
+    }
+    if (!inputs.empty())
+    {
+      updateBranch(0);
+    }
+    for (auto & thread : threads)
+    {
+      thread.join();
+    }
+    for (const auto & exception : exceptions)
+    {
+      if (exception)
+      {
+        std::rethrow_exception(exception);
+      }
+    }
+  }
   else
   {
     for (auto & input : m_Inputs)
@@ -1681,6 +1737,7 @@ ProcessObject::UpdateOutputData(DataObject * itkNotUsed(output))
 
   try
   {
+    const TraceEventScope traceEvent("GenerateData", this->GetNameOfClass());
     this->GenerateData();
   }
   catch (const ProcessAborted &)
@@ -1738,6 +1795,73 @@ ProcessObject::UpdateOutputData(DataObject * itkNotUsed(output))
 }
 
 
+bool
+ProcessObject::InputBranchesAreIndependent()
+{
+  // The ProcessObjects of the branches already visited, and, for each
+  // DataObject without a source, the number of branches which read it.
+  std::set<const ProcessObject *>   visitedProcessObjects;
+  std::map<const DataObject *, int> numberOfReadingBranches;
+  std::set<const DataObject *>      overwrittenInPlace;
+
+  for (auto & input : m_Inputs)
+  {
+    if (!input.second)
+    {
+      continue;
+    }
+
+    std::set<const ProcessObject *> branchProcessObjects;
+    std::set<const DataObject *>    branchSourcelessDataObjects;
+    std::vector<DataObject *>       toVisit{ input.second.GetPointer() };
+    while (!toVisit.empty())
+    {
+      DataObject * dataObject = toVisit.back();
+      toVisit.pop_back();
+
+      ProcessObject * source = dataObject->GetSource();
+      if (source == nullptr)
+      {
+        branchSourcelessDataObjects.insert(dataObject);
+        continue;
+      }
+      if (!branchProcessObjects.insert(source).second)
+      {
+        continue;
+      }
+      if (source == this || visitedProcessObjects.count(source) > 0)
+      {
+        // The branches share a ProcessObject, or the pipeline has a loop.
+        return false;
+      }
+      if (source->SupportsInPlace() && source->GetInPlaceExecution() && source->GetPrimaryInput())
+      {
+        overwrittenInPlace.insert(source->GetPrimaryInput());
+      }
+      for (const auto & sourceInput : source->m_Inputs)
+      {
+        if (sourceInput.second)
+        {
+          toVisit.push_back(sourceInput.second.GetPointer());
+        }
+      }
+    }
+
+    visitedProcessObjects.insert(branchProcessObjects.begin(), branchProcessObjects.end());
+    for (const DataObject * dataObject : branchSourcelessDataObjects)
+    {
+      ++numberOfReadingBranches[dataObject];
+    }
+  }
+
+  // A DataObject read by several branches must not be overwritten by any of them.
+  return std::none_of(overwrittenInPlace.begin(), overwrittenInPlace.end(), [&](const DataObject * dataObject) {
+    const auto readers = numberOfReadingBranches.find(dataObject);
+    return readers != numberOfReadingBranches.end() && readers->second > 1;
+  });
+}
+
+
 void
 ProcessObject::CacheInputReleaseDataFlags()
 {
@@ -1811,6 +1935,20 @@ ProcessObject::UpdateLargestPossibleRegion()
 }
 
 
+UpdateFuture
+ProcessObject::UpdateAsync()
+{
+  return UpdateFuture::Launch(this, false);
+}
+
+
+UpdateFuture
+ProcessObject::UpdateLargestPossibleRegionAsync()
+{
+  return UpdateFuture::Launch(this, true);
+}
+
+
 void
 ProcessObject::SetNumberOfRequiredInputs(DataObjectPointerArraySizeType nb)
 {
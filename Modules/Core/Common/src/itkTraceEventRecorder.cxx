@@ -0,0 +1,254 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#include "itkTraceEventRecorder.h"
+#include "itkMacro.h"
+#include "itkSingleton.h"
+#include "itksys/SystemTools.hxx"
+#include <atomic>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace itk
+{
+
+namespace
+{
+struct TraceEvent
+{
+  const char *                              Category;
+  const char *                              Name;
+  TraceEventRecorder::ClockType::time_point Begin;
+  TraceEventRecorder::ClockType::time_point End;
+  SizeValueType                             NumberOfBytes;
+};
+
+// The events recorded by one thread. Its mutex is only contended while the
+// events are written or cleared.
+struct TraceEventThreadBuffer
+{
+  std::mutex              m_Mutex{};
+  std::vector<TraceEvent> m_Events{};
+  unsigned int            m_ThreadIndex{ 0 };
+};
+} // namespace
+
+struct TraceEventRecorderGlobals
+{
+  TraceEventRecorderGlobals()
+  {
+    std::string fileName;
+    if (itksys::SystemTools::GetEnv("ITK_TRACE_FILE", fileName) && !fileName.empty())
+    {
+      m_FileName = fileName;
+      m_Enabled = true;
+    }
+  }
+
+  ~TraceEventRecorderGlobals()
+  {
+    // Write the events of a program traced through ITK_TRACE_FILE.
+    if (m_Enabled && !m_FileName.empty())
+    {
+      try
+      {
+        this->Write();
+      }
+      catch (const ExceptionObject & exception)
+      {
+        std::cerr << exception << std::endl;
+      }
+    }
+  }
+
+  void
+  Write();
+
+  std::atomic<bool>                                    m_Enabled{ false };
+  std::mutex                                           m_Mutex{};
+  std::string                                          m_FileName{};
+  std::vector<std::shared_ptr<TraceEventThreadBuffer>> m_ThreadBuffers{};
+  TraceEventRecorder::ClockType::time_point            m_Origin{ TraceEventRecorder::ClockType::now() };
+};
+
+itkGetGlobalSimpleMacro(TraceEventRecorder, TraceEventRecorderGlobals, PimplGlobals);
+TraceEventRecorderGlobals * TraceEventRecorder::m_PimplGlobals;
+
+namespace
+{
+void
+WriteEscaped(std::ostream & os, const char * text)
+{
+  for (const char * c = text; *c != '\0'; ++c)
+  {
+    if (*c == '"' || *c == '\\')
+    {
+      os << '\\' << *c;
+    }
+    else if (static_cast<unsigned char>(*c) >= 0x20)
+    {
+      os << *c;
+    }
+  }
+}
+
+double
+MicrosecondsBetween(TraceEventRecorder::ClockType::time_point begin, TraceEventRecorder::ClockType::time_point end)
+{
+  return std::chrono::duration<double, std::micro>(end - begin).count();
+}
+} // namespace
+
+
+void
+TraceEventRecorderGlobals::Write()
+{
+  const std::lock_guard<std::mutex> lockGuard(m_Mutex);
+
+  std::ofstream file(m_FileName);
+  if (!file)
+  {
+    itkGenericExceptionMacro("Cannot write the trace file " << m_FileName);
+  }
+  file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+  bool first = true;
+  for (const auto & threadBuffer : m_ThreadBuffers)
+  {
+    const std::lock_guard<std::mutex> threadLockGuard(threadBuffer->m_Mutex);
+    for (const TraceEvent & event : threadBuffer->m_Events)
+    {
+      file << (first ? "\n" : ",\n") << "{\"ph\":\"X\",\"pid\":1,\"tid\":" << threadBuffer->m_ThreadIndex
+           << ",\"ts\":" << MicrosecondsBetween(m_Origin, event.Begin)
+           << ",\"dur\":" << MicrosecondsBetween(event.Begin, event.End) << ",\"cat\":\"";
+      WriteEscaped(file, event.Category);
+      file << "\",\"name\":\"";
+      WriteEscaped(file, event.Name);
+      file << '"';
+      if (event.NumberOfBytes != 0)
+      {
+        file << ",\"args\":{\"bytes\":" << event.NumberOfBytes << '}';
+      }
+      file << '}';
+      first = false;
+    }
+    threadBuffer->m_Events.clear();
+  }
+  file << "\n]}\n";
+  if (!file)
+  {
+    itkGenericExceptionMacro("Cannot write the trace file " << m_FileName);
+  }
+}
+
+
+void
+TraceEventRecorder::SetEnabled(bool enabled)
+{
+  itkInitGlobalsMacro(PimplGlobals);
+  m_PimplGlobals->m_Enabled = enabled;
+}
+
+
+bool
+TraceEventRecorder::GetEnabled()
+{
+  itkInitGlobalsMacro(PimplGlobals);
+  return m_PimplGlobals->m_Enabled.load(std::memory_order_relaxed);
+}
+
+
+void
+TraceEventRecorder::SetFileName(const std::string & fileName)
+{
+  itkInitGlobalsMacro(PimplGlobals);
+  const std::lock_guard<std::mutex> lockGuard(m_PimplGlobals->m_Mutex);
+  m_PimplGlobals->m_FileName = fileName;
+}
+
+
+std::string
+TraceEventRecorder::GetFileName()
+{
+  itkInitGlobalsMacro(PimplGlobals);
+  const std::lock_guard<std::mutex> lockGuard(m_PimplGlobals->m_Mutex);
+  return m_PimplGlobals->m_FileName;
+}
+
+
+void
+TraceEventRecorder::RecordEvent(const char *          category,
+                                const char *          name,
+                                ClockType::time_point begin,
+                                ClockType::time_point end,
+                                SizeValueType         numberOfBytes)
+{
+  itkInitGlobalsMacro(PimplGlobals);
+
+  // The buffer of each thread is registered on its first event, and kept by
+  // the globals after the thread exits.
+  thread_local const std::shared_ptr<TraceEventThreadBuffer> threadBuffer = [] {
+    auto                              buffer = std::make_shared<TraceEventThreadBuffer>();
+    const std::lock_guard<std::mutex> lockGuard(m_PimplGlobals->m_Mutex);
+    buffer->m_ThreadIndex = static_cast<unsigned int>(m_PimplGlobals->m_ThreadBuffers.size());
+    m_PimplGlobals->m_ThreadBuffers.push_back(buffer);
+    return buffer;
+  }();
+
+  const std::lock_guard<std::mutex> lockGuard(threadBuffer->m_Mutex);
+  threadBuffer->m_Events.push_back({ category, name, begin, end, numberOfBytes });
+}
+
+
+SizeValueType
+TraceEventRecorder::GetNumberOfEvents()
+{
+  itkInitGlobalsMacro(PimplGlobals);
+  const std::lock_guard<std::mutex> lockGuard(m_PimplGlobals->m_Mutex);
+  SizeValueType                     numberOfEvents = 0;
+  for (const auto & threadBuffer : m_PimplGlobals->m_ThreadBuffers)
+  {
+    const std::lock_guard<std::mutex> threadLockGuard(threadBuffer->m_Mutex);
+    numberOfEvents += threadBuffer->m_Events.size();
+  }
+  return numberOfEvents;
+}
+
+
+void
+TraceEventRecorder::Clear()
+{
+  itkInitGlobalsMacro(PimplGlobals);
+  const std::lock_guard<std::mutex> lockGuard(m_PimplGlobals->m_Mutex);
+  for (const auto & threadBuffer : m_PimplGlobals->m_ThreadBuffers)
+  {
+    const std::lock_guard<std::mutex> threadLockGuard(threadBuffer->m_Mutex);
+    threadBuffer->m_Events.clear();
+  }
+}
+
+
+void
+TraceEventRecorder::WriteTraceFile()
+{
+  itkInitGlobalsMacro(PimplGlobals);
+  m_PimplGlobals->Write();
+}
+
+} // end namespace itk
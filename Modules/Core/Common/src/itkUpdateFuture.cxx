@@ -0,0 +1,282 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#include "itkUpdateFuture.h"
+#include "itkProcessObject.h"
+#include "itkSingleton.h"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+namespace itk
+{
+
+struct UpdateFutureGlobals
+{
+  ~UpdateFutureGlobals()
+  {
+    {
+      const std::lock_guard<std::mutex> lockGuard(m_Mutex);
+      m_Stop = true;
+    }
+    m_Condition.notify_all();
+    for (auto & thread : m_Threads)
+    {
+      thread.join();
+    }
+  }
+
+  std::mutex                        m_Mutex{};
+  std::condition_variable           m_Condition{};
+  std::deque<std::function<void()>> m_Queue{};
+  std::vector<std::thread>          m_Threads{};
+  unsigned int                      m_NumberOfIdleThreads{ 0 };
+  unsigned int                      m_MaximumNumberOfConcurrentUpdates{ 4 };
+  bool                              m_Stop{ false };
+};
+
+struct UpdateFutureState
+{
+  ProcessObject::Pointer       m_ProcessObject{};
+  std::vector<ProcessObject *> m_UpstreamProcessObjects{};
+  std::atomic<bool>            m_Cancelled{ false };
+
+  std::mutex                m_Mutex{};
+  std::set<ProcessObject *> m_Executing{};
+  SizeValueType             m_NumberOfExecuted{ 0 };
+};
+
+itkGetGlobalSimpleMacro(UpdateFuture, UpdateFutureGlobals, PimplGlobals);
+UpdateFutureGlobals * UpdateFuture::m_PimplGlobals;
+
+namespace
+{
+// Body of the threads which run the queued updates.
+void
+RunQueuedUpdates(UpdateFutureGlobals * globals)
+{
+  std::unique_lock<std::mutex> lock(globals->m_Mutex);
+  while (true)
+  {
+    ++globals->m_NumberOfIdleThreads;
+    globals->m_Condition.wait(lock, [globals] { return globals->m_Stop || !globals->m_Queue.empty(); });
+    --globals->m_NumberOfIdleThreads;
+    if (globals->m_Queue.empty())
+    {
+      return;
+    }
+    const std::function<void()> update = std::move(globals->m_Queue.front());
+    globals->m_Queue.pop_front();
+    lock.unlock();
+    update();
+    lock.lock();
+  }
+}
+
+// The ProcessObjects which an update of processObject may execute.
+std::vector<ProcessObject *>
+GetUpstreamProcessObjects(ProcessObject * processObject)
+{
+  std::vector<ProcessObject *> processObjects;
+  std::set<ProcessObject *>    visited;
+  std::vector<ProcessObject *> toVisit{ processObject };
+  while (!toVisit.empty())
+  {
+    ProcessObject * current = toVisit.back();
+    toVisit.pop_back();
+    if (!visited.insert(current).second)
+    {
+      continue;
+    }
+    processObjects.push_back(current);
+    for (const auto & input : current->GetInputs())
+    {
+      if (input.IsNotNull() && input->GetSource().IsNotNull())
+      {
+        toVisit.push_back(input->GetSource());
+      }
+    }
+  }
+  return processObjects;
+}
+} // namespace
+
+
+float
+UpdateFuture::GetProgress() const
+{
+  if (!m_State)
+  {
+    return 0.0f;
+  }
+  if (this->IsReady())
+  {
+    return 1.0f;
+  }
+
+  const std::lock_guard<std::mutex> lockGuard(m_State->m_Mutex);
+  double                            progress = static_cast<double>(m_State->m_NumberOfExecuted);
+  for (const ProcessObject * processObject : m_State->m_Executing)
+  {
+    progress += processObject->GetProgress();
+  }
+  return static_cast<float>(std::min(1.0, progress / m_State->m_UpstreamProcessObjects.size()));
+}
+
+
+void
+UpdateFuture::Cancel()
+{
+  if (!m_State)
+  {
+    return;
+  }
+  m_State->m_Cancelled = true;
+
+  const std::lock_guard<std::mutex> lockGuard(m_State->m_Mutex);
+  for (ProcessObject * processObject : m_State->m_Executing)
+  {
+    processObject->AbortGenerateDataOn();
+  }
+}
+
+
+bool
+UpdateFuture::IsCancelled() const
+{
+  return m_State && m_State->m_Cancelled;
+}
+
+
+void
+UpdateFuture::SetMaximumNumberOfConcurrentUpdates(unsigned int maximumNumberOfConcurrentUpdates)
+{
+  itkInitGlobalsMacro(PimplGlobals);
+  const std::lock_guard<std::mutex> lockGuard(m_PimplGlobals->m_Mutex);
+  m_PimplGlobals->m_MaximumNumberOfConcurrentUpdates = std::max(1u, maximumNumberOfConcurrentUpdates);
+}
+
+
+unsigned int
+UpdateFuture::GetMaximumNumberOfConcurrentUpdates()
+{
+  itkInitGlobalsMacro(PimplGlobals);
+  const std::lock_guard<std::mutex> lockGuard(m_PimplGlobals->m_Mutex);
+  return m_PimplGlobals->m_MaximumNumberOfConcurrentUpdates;
+}
+
+
+UpdateFuture
+UpdateFuture::Launch(ProcessObject * processObject, bool largestPossibleRegion)
+{
+  itkInitGlobalsMacro(PimplGlobals);
+
+  const auto state = std::make_shared<UpdateFutureState>();
+  state->m_ProcessObject = processObject;
+  state->m_UpstreamProcessObjects = GetUpstreamProcessObjects(processObject);
+
+  const auto   promise = std::make_shared<std::promise<void>>();
+  UpdateFuture future;
+  future.m_State = state;
+  future.m_Future = promise->get_future().share();
+
+  const auto update = [state, promise, largestPossibleRegion]() {
+    // Track which ProcessObjects execute, and abort them once cancelled.
+    UpdateFutureState *                                    rawState = state.get();
+    std::vector<std::pair<ProcessObject *, unsigned long>> observers;
+    for (ProcessObject * upstream : state->m_UpstreamProcessObjects)
+    {
+      observers.emplace_back(upstream, upstream->AddObserver(StartEvent(), [rawState, upstream](const EventObject &) {
+        const std::lock_guard<std::mutex> lockGuard(rawState->m_Mutex);
+        rawState->m_Executing.insert(upstream);
+      }));
+      observers.emplace_back(upstream, upstream->AddObserver(EndEvent(), [rawState, upstream](const EventObject &) {
+        const std::lock_guard<std::mutex> lockGuard(rawState->m_Mutex);
+        rawState->m_Executing.erase(upstream);
+        ++rawState->m_NumberOfExecuted;
+      }));
+      observers.emplace_back(upstream,
+                             upstream->AddObserver(ProgressEvent(), [rawState, upstream](const EventObject &) {
+                               if (rawState->m_Cancelled && !upstream->GetAbortGenerateData())
+                               {
+                                 upstream->AbortGenerateDataOn();
+                               }
+                             }));
+    }
+
+    std::exception_ptr exception;
+    try
+    {
+      if (state->m_Cancelled)
+      {
+        ProcessAborted aborted(__FILE__, __LINE__);
+        aborted.SetDescription("The update was cancelled before it started.");
+        throw aborted;
+      }
+      if (largestPossibleRegion)
+      {
+        state->m_ProcessObject->UpdateLargestPossibleRegion();
+      }
+      else
+      {
+        state->m_ProcessObject->Update();
+      }
+    }
+    catch (...)
+    {
+      exception = std::current_exception();
+      state->m_ProcessObject->ResetPipeline();
+    }
+
+    for (const auto & observer : observers)
+    {
+      observer.first->RemoveObserver(observer.second);
+    }
+    {
+      const std::lock_guard<std::mutex> lockGuard(rawState->m_Mutex);
+      rawState->m_Executing.clear();
+    }
+    if (exception)
+    {
+      promise->set_exception(exception);
+    }
+    else
+    {
+      promise->set_value();
+    }
+  };
+
+  {
+    const std::lock_guard<std::mutex> lockGuard(m_PimplGlobals->m_Mutex);
+    m_PimplGlobals->m_Queue.emplace_back(update);
+    if (m_PimplGlobals->m_Queue.size() > m_PimplGlobals->m_NumberOfIdleThreads &&
+        m_PimplGlobals->m_Threads.size() < m_PimplGlobals->m_MaximumNumberOfConcurrentUpdates)
+    {
+      m_PimplGlobals->m_Threads.emplace_back(RunQueuedUpdates, m_PimplGlobals);
+    }
+  }
+  m_PimplGlobals->m_Condition.notify_one();
+  return future;
+}
+
+} // end namespace itk
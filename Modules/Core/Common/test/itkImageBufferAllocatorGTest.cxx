@@ -0,0 +1,130 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#include "itkImageBufferAllocator.h"
+#include "itkGTest.h"
+
+#include "itkImage.h"
+#include "itkMemoryUsageObserver.h"
+#include <cstdint>
+
+namespace
+{
+bool
+IsAligned(const void * buffer, size_t alignment)
+{
+  return reinterpret_cast<std::uintptr_t>(buffer) % alignment == 0;
+}
+} // namespace
+
+
+TEST(ImageBufferAllocator, AlignsBuffers)
+{
+  const auto allocator = itk::ImageBufferAllocator::New();
+
+  void * small = allocator->Allocate(100);
+  void * large = allocator->Allocate(3 * itk::ImageBufferAllocator::HugePageSize + 1);
+  EXPECT_TRUE(IsAligned(small, itk::ImageBufferAllocator::Alignment));
+  EXPECT_TRUE(IsAligned(large, itk::ImageBufferAllocator::HugePageSize));
+
+  allocator->Deallocate(small, 100);
+  allocator->Deallocate(large, 3 * itk::ImageBufferAllocator::HugePageSize + 1);
+  EXPECT_EQ(allocator->GetAllocatedBytes(), 0u);
+}
+
+
+TEST(ImageBufferAllocator, RecyclesSameSizedBuffers)
+{
+  const auto allocator = itk::ImageBufferAllocator::New();
+
+  constexpr size_t numberOfBytes = 1 << 20;
+  void *           first = allocator->Allocate(numberOfBytes);
+  EXPECT_EQ(allocator->GetAllocatedBytes(), numberOfBytes);
+  allocator->Deallocate(first, numberOfBytes);
+  EXPECT_EQ(allocator->GetPooledBytes(), numberOfBytes);
+
+  void * second = allocator->Allocate(numberOfBytes);
+  EXPECT_EQ(second, first);
+  EXPECT_EQ(allocator->GetNumberOfAllocations(), 2u);
+  EXPECT_EQ(allocator->GetNumberOfPoolHits(), 1u);
+  EXPECT_EQ(allocator->GetPooledBytes(), 0u);
+  EXPECT_EQ(allocator->GetPeakAllocatedBytes(), numberOfBytes);
+
+  // A buffer which does not fit in the pool is returned to the system.
+  allocator->SetPoolCapacity(numberOfBytes / 2);
+  allocator->Deallocate(second, numberOfBytes);
+  EXPECT_EQ(allocator->GetPooledBytes(), 0u);
+  EXPECT_EQ(allocator->GetAllocatedBytes(), 0u);
+}
+
+
+TEST(ImageBufferAllocator, ReleasePool)
+{
+  const auto allocator = itk::ImageBufferAllocator::New();
+
+  void * buffer = allocator->Allocate(5000);
+  allocator->Deallocate(buffer, 5000);
+  EXPECT_GT(allocator->GetPooledBytes(), 0u);
+
+  allocator->ReleasePool();
+  EXPECT_EQ(allocator->GetPooledBytes(), 0u);
+}
+
+
+TEST(ImageBufferAllocator, GlobalAllocatorServesImageBuffers)
+{
+  using ImageType = itk::Image<float, 3>;
+
+  const auto allocator = itk::ImageBufferAllocator::New();
+  itk::ImageBufferAllocator::SetGlobalAllocator(allocator);
+  EXPECT_EQ(itk::ImageBufferAllocator::GetGlobalAllocator(), allocator);
+
+  itk::ImageBufferAllocatorMemoryUsageObserver observer;
+  EXPECT_EQ(observer.GetMemoryUsage(), 0u);
+
+  const float * firstBuffer = nullptr;
+  {
+    auto image = ImageType::New();
+    image->SetRegions(ImageType::SizeType::Filled(64));
+    image->AllocateInitialized();
+    firstBuffer = image->GetBufferPointer();
+    EXPECT_TRUE(IsAligned(firstBuffer, itk::ImageBufferAllocator::Alignment));
+    EXPECT_EQ(image->GetPixel(ImageType::IndexType::Filled(5)), 0.0f);
+    EXPECT_EQ(observer.GetMemoryUsage(), 64u * 64u * 64u * sizeof(float) / 1024u);
+    image->FillBuffer(1.0f);
+  }
+
+  // The buffer of the released image is recycled, and zero-filled again.
+  auto image = ImageType::New();
+  image->SetRegions(ImageType::SizeType::Filled(64));
+  image->AllocateInitialized();
+  EXPECT_EQ(image->GetBufferPointer(), firstBuffer);
+  EXPECT_EQ(image->GetPixel(ImageType::IndexType::Filled(5)), 0.0f);
+  EXPECT_EQ(allocator->GetNumberOfPoolHits(), 1u);
+
+  // Buffers allocated before the allocator is uninstalled are still returned to it.
+  itk::ImageBufferAllocator::SetGlobalAllocator(nullptr);
+  image = nullptr;
+  EXPECT_EQ(allocator->GetAllocatedBytes(), 0u);
+  EXPECT_EQ(observer.GetMemoryUsage(), 0u);
+
+  // Without an allocator, buffers come from new[] as before.
+  EXPECT_EQ(itk::ImageBufferAllocator::AllocateGlobal(16, false), nullptr);
+  auto * buffer = new float[4];
+  EXPECT_FALSE(itk::ImageBufferAllocator::DeallocateGlobal(buffer));
+  delete[] buffer;
+}
@@ -0,0 +1,175 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkImageRegionSplitterTiled.h"
+#include "itkGTest.h"
+
+#include "itkImage.h"
+#include "itkImageRegionConstIterator.h"
+#include "itkImageRegionIterator.h"
+#include "itkPoolMultiThreader.h"
+#include <atomic>
+
+namespace
+{
+using CountImageType = itk::Image<unsigned int, 3>;
+
+// Splits the region in requestedNumber tiles, checks that the tiles cover it
+// exactly once, and returns them.
+template <unsigned int VDimension>
+std::vector<itk::ImageRegion<VDimension>>
+SplitAndCheckCoverage(const itk::ImageRegionSplitterBase * splitter,
+                      const itk::ImageRegion<VDimension> & region,
+                      unsigned int                         requestedNumber)
+{
+  const unsigned int numberOfSplits = splitter->GetNumberOfSplits(region, requestedNumber);
+  EXPECT_GE(numberOfSplits, 1u);
+  EXPECT_LE(numberOfSplits, requestedNumber);
+
+  using ImageType = itk::Image<unsigned int, VDimension>;
+  auto image = ImageType::New();
+  image->SetRegions(region);
+  image->AllocateInitialized();
+
+  std::vector<itk::ImageRegion<VDimension>> tiles;
+  for (unsigned int i = 0; i < numberOfSplits; ++i)
+  {
+    itk::ImageRegion<VDimension> tile = region;
+    EXPECT_EQ(splitter->GetSplit(i, numberOfSplits, tile), numberOfSplits);
+    EXPECT_TRUE(region.IsInside(tile));
+    for (itk::ImageRegionIterator<ImageType> it(image, tile); !it.IsAtEnd(); ++it)
+    {
+      ++it.Value();
+    }
+    tiles.push_back(tile);
+  }
+  for (itk::ImageRegionConstIterator<ImageType> it(image, region); !it.IsAtEnd(); ++it)
+  {
+    EXPECT_EQ(it.Get(), 1u);
+  }
+  return tiles;
+}
+} // namespace
+
+
+TEST(ImageRegionSplitterTiled, CoversRegionExactly)
+{
+  const auto splitter = itk::ImageRegionSplitterTiled::New();
+
+  const itk::ImageRegion<3> region({ { 3, -2, 5 } }, { { 40, 30, 20 } });
+  for (const unsigned int requestedNumber : { 1u, 2u, 3u, 7u, 16u, 100u, 1000u })
+  {
+    SplitAndCheckCoverage(splitter.GetPointer(), region, requestedNumber);
+  }
+  EXPECT_EQ(splitter->GetNumberOfSplits(region, 1), 1u);
+
+  splitter->SetKernelRadius(3);
+  splitter->SetCacheSize(1024);
+  for (const unsigned int requestedNumber : { 2u, 9u, 64u, 200u })
+  {
+    SplitAndCheckCoverage(splitter.GetPointer(), region, requestedNumber);
+  }
+
+  const itk::ImageRegion<1> lineRegion({ { 0 } }, { { 10 } });
+  EXPECT_EQ(SplitAndCheckCoverage(splitter.GetPointer(), lineRegion, 20).size(), 10u);
+}
+
+
+TEST(ImageRegionSplitterTiled, KeepsRowsWholeWhenTheyFitInCache)
+{
+  const auto splitter = itk::ImageRegionSplitterTiled::New();
+  splitter->SetKernelRadius(1);
+
+  // A thin slab: the tiles are split along both slow dimensions, but not
+  // along the rows.
+  const itk::ImageRegion<3> region({ { 0, 0, 0 } }, { { 256, 256, 4 } });
+  const auto                tiles = SplitAndCheckCoverage(splitter.GetPointer(), region, 64);
+  EXPECT_EQ(tiles.size(), 64u);
+  for (const auto & tile : tiles)
+  {
+    EXPECT_EQ(tile.GetSize(0), 256u);
+    EXPECT_LT(tile.GetSize(1), 256u);
+  }
+}
+
+
+TEST(ImageRegionSplitterTiled, SplitsRowsThatDoNotFitInCache)
+{
+  const auto splitter = itk::ImageRegionSplitterTiled::New();
+  splitter->SetCacheSize(4096);
+  splitter->SetBytesPerPixel(4);
+
+  const itk::ImageRegion<2> region({ { 0, 0 } }, { { 2048, 2 } });
+  const auto                tiles = SplitAndCheckCoverage(splitter.GetPointer(), region, 8);
+  EXPECT_EQ(tiles.size(), 8u);
+  for (const auto & tile : tiles)
+  {
+    EXPECT_LT(tile.GetSize(0), 2048u);
+  }
+}
+
+
+TEST(ImageRegionSplitterTiled, OverDecomposesParallelizeImageRegion)
+{
+  const itk::MultiThreaderBase::Pointer threader = itk::PoolMultiThreader::New();
+  threader->SetNumberOfWorkUnits(2);
+  threader->SetOverDecomposition(8);
+  threader->SetImageRegionSplitter(itk::ImageRegionSplitterTiled::New());
+  EXPECT_EQ(threader->GetOverDecomposition(), 8u);
+
+  const itk::ImageRegion<3> region({ { 0, 0, 0 } }, { { 64, 64, 8 } });
+  auto                      image = CountImageType::New();
+  image->SetRegions(region);
+  image->AllocateInitialized();
+
+  std::atomic<unsigned int> numberOfPieces{ 0 };
+  threader->ParallelizeImageRegion<3>(
+    region,
+    [&image, &numberOfPieces](const itk::ImageRegion<3> & piece) {
+      ++numberOfPieces;
+      for (itk::ImageRegionIterator<CountImageType> it(image, piece); !it.IsAtEnd(); ++it)
+      {
+        ++it.Value();
+      }
+    },
+    nullptr);
+
+  EXPECT_EQ(numberOfPieces, 16u);
+  for (itk::ImageRegionConstIterator<CountImageType> it(image, region); !it.IsAtEnd(); ++it)
+  {
+    EXPECT_EQ(it.Get(), 1u);
+  }
+}
+
+
+TEST(ImageRegionSplitterTiled, AutoTuneCoarsensTinyWorkUnits)
+{
+  const itk::MultiThreaderBase::Pointer threader = itk::PoolMultiThreader::New();
+  threader->SetNumberOfWorkUnits(2);
+  threader->SetOverDecomposition(8);
+  threader->AutoTuneOverDecompositionOn();
+
+  // Pieces that do (almost) nothing cost less than the scheduling overhead,
+  // so every update halves the over-decomposition.
+  const itk::ImageRegion<2> region({ { 0, 0 } }, { { 64, 64 } });
+  for (const unsigned int expected : { 4u, 2u, 1u, 1u })
+  {
+    threader->ParallelizeImageRegion<2>(region, [](const itk::ImageRegion<2> &) {}, nullptr);
+    EXPECT_EQ(threader->GetOverDecomposition(), expected);
+  }
+}
@@ -0,0 +1,132 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+// First include the header file to be tested:
+#include "itkNeighborhoodAlgorithm.h"
+
+#include "itkConstantBoundaryCondition.h"
+#include "itkConstantBoundaryImageNeighborhoodPixelAccessPolicy.h"
+#include "itkConstNeighborhoodIterator.h"
+#include "itkImage.h"
+#include "itkImageNeighborhoodOffsets.h"
+#include "itkIndexRange.h"
+#include <gtest/gtest.h>
+
+#include <numeric> // For accumulate.
+
+namespace
+{
+using ImageType = itk::Image<int, 2>;
+
+ImageType::Pointer
+CreateImage()
+{
+  const auto image = ImageType::New();
+  image->SetRegions(ImageType::RegionType({ { 1, -2 } }, { { 9, 7 } }));
+  image->Allocate();
+
+  int value = 0;
+  for (const auto & index : itk::ImageRegionIndexRange<2>(image->GetBufferedRegion()))
+  {
+    image->SetPixel(index, (value * 7) % 11);
+    ++value;
+  }
+  return image;
+}
+
+// Sums the neighborhood of each pixel of the region by means of
+// ProcessNonBoundaryRegionAndBoundaryFaces, and checks it against the
+// equivalent ConstNeighborhoodIterator.
+template <template <typename> class TBoundaryPixelAccessPolicy, typename... TBoundaryParameter>
+void
+ExpectSameSumsAsNeighborhoodIterator(const ImageType::RegionType &            region,
+                                     itk::ImageBoundaryCondition<ImageType> & boundaryCondition,
+                                     const TBoundaryParameter &... boundaryParameter)
+{
+  const auto        image = CreateImage();
+  const ImageType & constImage = *image;
+  const auto        radius = ImageType::SizeType{ { 2, 1 } };
+
+  const auto output = ImageType::New();
+  output->SetRegions(image->GetBufferedRegion());
+  output->AllocateInitialized();
+
+  itk::NeighborhoodAlgorithm::ProcessNonBoundaryRegionAndBoundaryFaces<TBoundaryPixelAccessPolicy>(
+    constImage,
+    region,
+    itk::GenerateRectangularImageNeighborhoodOffsets(radius),
+    [&output](const auto & subregion, auto & neighborhoodRange) {
+      for (const auto & index : itk::ImageRegionIndexRange<2>(subregion))
+      {
+        neighborhoodRange.SetLocation(index);
+        EXPECT_EQ(output->GetPixel(index), 0) << "Pixel " << index << " processed twice!";
+        output->SetPixel(index, 1 + std::accumulate(neighborhoodRange.cbegin(), neighborhoodRange.cend(), 0));
+      }
+    },
+    boundaryParameter...);
+
+  itk::ConstNeighborhoodIterator<ImageType> neighborhoodIterator(radius, image, region);
+  neighborhoodIterator.OverrideBoundaryCondition(&boundaryCondition);
+
+  for (const auto & index : itk::ImageRegionIndexRange<2>(image->GetBufferedRegion()))
+  {
+    if (region.IsInside(index))
+    {
+      neighborhoodIterator.SetLocation(index);
+      int expectedSum = 0;
+      for (unsigned int i = 0; i < neighborhoodIterator.Size(); ++i)
+      {
+        expectedSum += neighborhoodIterator.GetPixel(i);
+      }
+      EXPECT_EQ(output->GetPixel(index), 1 + expectedSum) << "Pixel " << index;
+    }
+    else
+    {
+      EXPECT_EQ(output->GetPixel(index), 0) << "Pixel " << index << " outside the region was processed!";
+    }
+  }
+}
+} // namespace
+
+
+TEST(NeighborhoodAlgorithm, ProcessNonBoundaryRegionAndBoundaryFacesWithZeroFluxNeumann)
+{
+  itk::ZeroFluxNeumannBoundaryCondition<ImageType> boundaryCondition;
+  const auto                                       image = CreateImage();
+
+  ExpectSameSumsAsNeighborhoodIterator<itk::ZeroFluxNeumannImageNeighborhoodPixelAccessPolicy>(
+    image->GetBufferedRegion(), boundaryCondition);
+  ExpectSameSumsAsNeighborhoodIterator<itk::ZeroFluxNeumannImageNeighborhoodPixelAccessPolicy>(
+    ImageType::RegionType({ { 2, 0 } }, { { 5, 3 } }), boundaryCondition);
+}
+
+
+TEST(NeighborhoodAlgorithm, ProcessNonBoundaryRegionAndBoundaryFacesWithConstantBoundary)
+{
+  constexpr int                            constant = 42;
+  itk::ConstantBoundaryCondition<ImageType> boundaryCondition;
+  boundaryCondition.SetConstant(constant);
+  const auto image = CreateImage();
+
+  ExpectSameSumsAsNeighborhoodIterator<itk::ConstantBoundaryImageNeighborhoodPixelAccessPolicy>(
+    image->GetBufferedRegion(), boundaryCondition, constant);
+
+  // A region too small to have a non-boundary part.
+  ExpectSameSumsAsNeighborhoodIterator<itk::ConstantBoundaryImageNeighborhoodPixelAccessPolicy>(
+    ImageType::RegionType({ { 8, 4 } }, { { 2, 1 } }), boundaryCondition, constant);
+}
@@ -0,0 +1,157 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#include "itkPipelineMemoryPlanner.h"
+#include "itkGTest.h"
+
+#include "itkImageRegionIterator.h"
+#include "itkInPlaceImageFilter.h"
+
+namespace
+{
+using ImageType = itk::Image<float, 2>;
+
+// Adds one to its first input, plus its second input when it has one, and
+// counts its executions.
+class AddOneImageFilter : public itk::InPlaceImageFilter<ImageType, ImageType>
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(AddOneImageFilter);
+
+  using Self = AddOneImageFilter;
+  using Superclass = itk::InPlaceImageFilter<ImageType, ImageType>;
+  using Pointer = itk::SmartPointer<Self>;
+
+  itkNewMacro(Self);
+  itkOverrideGetNameOfClassMacro(AddOneImageFilter);
+
+  unsigned int NumberOfExecutions{ 0 };
+
+protected:
+  AddOneImageFilter() { this->DynamicMultiThreadingOn(); }
+
+  void
+  BeforeThreadedGenerateData() override
+  {
+    ++NumberOfExecutions;
+  }
+
+  void
+  DynamicThreadedGenerateData(const OutputImageRegionType & region) override
+  {
+    const ImageType * second = this->GetNumberOfIndexedInputs() > 1 ? this->GetInput(1) : nullptr;
+
+    itk::ImageRegionConstIterator<ImageType> inputIt(this->GetInput(), region);
+    itk::ImageRegionIterator<ImageType>      outputIt(this->GetOutput(), region);
+    for (; !outputIt.IsAtEnd(); ++inputIt, ++outputIt)
+    {
+      const float secondValue = second ? second->GetPixel(outputIt.GetIndex()) : 0.0f;
+      outputIt.Set(inputIt.Get() + secondValue + 1.0f);
+    }
+  }
+};
+
+ImageType::Pointer
+MakeImage()
+{
+  auto image = ImageType::New();
+  image->SetRegions(ImageType::SizeType::Filled(16));
+  image->Allocate();
+  image->FillBuffer(10.0f);
+  return image;
+}
+} // namespace
+
+
+TEST(PipelineMemoryPlanner, ChainRunsInPlaceButKeepsSourceImage)
+{
+  const auto image = MakeImage();
+
+  auto first = AddOneImageFilter::New();
+  first->SetInput(image);
+  auto second = AddOneImageFilter::New();
+  second->SetInput(first->GetOutput());
+  auto third = AddOneImageFilter::New();
+  third->SetInput(second->GetOutput());
+  third->InPlaceOff();
+
+  auto planner = itk::PipelineMemoryPlanner::New();
+  planner->SetOutput(third->GetOutput());
+  planner->Update();
+
+  EXPECT_EQ(third->GetOutput()->GetPixel({ { 3, 4 } }), 13.0f);
+  EXPECT_EQ(image->GetPixel({ { 3, 4 } }), 10.0f);
+
+  // The image without a source is not overwritten; the intermediate results are.
+  const auto & schedule = planner->GetSchedule();
+  ASSERT_EQ(schedule.size(), 3u);
+  EXPECT_FALSE(schedule[0].InPlace);
+  EXPECT_TRUE(schedule[1].InPlace);
+  EXPECT_TRUE(schedule[2].InPlace);
+  EXPECT_EQ(schedule[0].NumberOfReleasedDataObjects, 0u);
+  EXPECT_EQ(schedule[1].NumberOfReleasedDataObjects, 1u);
+  EXPECT_EQ(schedule[2].NumberOfReleasedDataObjects, 1u);
+
+  // The InPlace settings are restored after the update.
+  EXPECT_TRUE(first->GetInPlace());
+  EXPECT_FALSE(third->GetInPlace());
+}
+
+
+TEST(PipelineMemoryPlanner, SharedIntermediateIsReleasedAfterItsLastConsumer)
+{
+  const auto image = MakeImage();
+
+  // common feeds both left and right, which are summed by last.
+  auto common = AddOneImageFilter::New();
+  common->SetInput(image);
+  auto left = AddOneImageFilter::New();
+  left->SetInput(common->GetOutput());
+  auto right = AddOneImageFilter::New();
+  right->SetInput(common->GetOutput());
+  auto last = AddOneImageFilter::New();
+  last->SetInput(0, left->GetOutput());
+  last->SetInput(1, right->GetOutput());
+
+  auto planner = itk::PipelineMemoryPlanner::New();
+  planner->SetOutput(last->GetOutput());
+  planner->Update();
+
+  // Without planning, left would overwrite the output of common, which would
+  // then be computed again for right.
+  EXPECT_EQ(last->GetOutput()->GetPixel({ { 1, 2 } }), 2.0f * 12.0f + 1.0f);
+  EXPECT_EQ(common->NumberOfExecutions, 1u);
+
+  const auto & schedule = planner->GetSchedule();
+  ASSERT_EQ(schedule.size(), 4u);
+  itk::SizeValueType numberOfReleased = 0;
+  for (const auto & step : schedule)
+  {
+    // Only last has inputs which nothing else consumes.
+    EXPECT_EQ(step.InPlace, &step == &schedule.back());
+    numberOfReleased += step.NumberOfReleasedDataObjects;
+  }
+  // The output of common, left, and right.
+  EXPECT_EQ(numberOfReleased, 3u);
+  EXPECT_EQ(common->GetOutput()->GetBufferPointer(), nullptr);
+
+  // A persistent intermediate result is kept.
+  planner->AddPersistentDataObject(common->GetOutput());
+  image->Modified();
+  planner->Update();
+  EXPECT_EQ(common->GetOutput()->GetPixel({ { 1, 2 } }), 11.0f);
+}
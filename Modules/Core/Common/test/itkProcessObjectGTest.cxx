@@ -0,0 +1,129 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#include "itkProcessObject.h"
+#include "itkGTest.h"
+
+#include "itkImageRegionIterator.h"
+#include "itkInPlaceImageFilter.h"
+#include <thread>
+
+namespace
+{
+using ImageType = itk::Image<float, 2>;
+
+// Adds one to the sum of its inputs, and records the thread it is updated in.
+class AddOneImageFilter : public itk::InPlaceImageFilter<ImageType, ImageType>
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(AddOneImageFilter);
+
+  using Self = AddOneImageFilter;
+  using Superclass = itk::InPlaceImageFilter<ImageType, ImageType>;
+  using Pointer = itk::SmartPointer<Self>;
+
+  itkNewMacro(Self);
+  itkOverrideGetNameOfClassMacro(AddOneImageFilter);
+
+  std::thread::id UpdateThread{};
+
+protected:
+  AddOneImageFilter()
+  {
+    this->DynamicMultiThreadingOn();
+    this->InPlaceOff();
+  }
+
+  void
+  BeforeThreadedGenerateData() override
+  {
+    UpdateThread = std::this_thread::get_id();
+  }
+
+  void
+  DynamicThreadedGenerateData(const OutputImageRegionType & region) override
+  {
+    for (itk::ImageRegionIterator<ImageType> outputIt(this->GetOutput(), region); !outputIt.IsAtEnd(); ++outputIt)
+    {
+      float sum = 1.0f;
+      for (unsigned int i = 0; i < this->GetNumberOfIndexedInputs(); ++i)
+      {
+        sum += this->GetInput(i)->GetPixel(outputIt.GetIndex());
+      }
+      outputIt.Set(sum);
+    }
+  }
+};
+
+ImageType::Pointer
+MakeImage(float value)
+{
+  auto image = ImageType::New();
+  image->SetRegions(ImageType::SizeType::Filled(16));
+  image->Allocate();
+  image->FillBuffer(value);
+  return image;
+}
+} // namespace
+
+
+TEST(ProcessObject, UpdateInputsConcurrentlyUpdatesIndependentBranchesInTheirOwnThreads)
+{
+  const auto firstImage = MakeImage(1.0f);
+  const auto secondImage = MakeImage(2.0f);
+
+  auto firstBranch = AddOneImageFilter::New();
+  firstBranch->SetInput(firstImage);
+  auto secondBranch = AddOneImageFilter::New();
+  secondBranch->SetInput(secondImage);
+  auto thirdBranch = AddOneImageFilter::New();
+  thirdBranch->SetInput(firstImage); // Only read, so it does not make the branches dependent.
+
+  auto sum = AddOneImageFilter::New();
+  sum->SetInput(0, firstBranch->GetOutput());
+  sum->SetInput(1, secondBranch->GetOutput());
+  sum->SetInput(2, thirdBranch->GetOutput());
+  EXPECT_FALSE(sum->GetUpdateInputsConcurrently());
+  sum->UpdateInputsConcurrentlyOn();
+  sum->Update();
+
+  EXPECT_EQ(sum->GetOutput()->GetPixel({ { 4, 2 } }), 2.0f + 3.0f + 2.0f + 1.0f);
+  EXPECT_NE(firstBranch->UpdateThread, secondBranch->UpdateThread);
+  EXPECT_NE(secondBranch->UpdateThread, thirdBranch->UpdateThread);
+  EXPECT_NE(firstBranch->UpdateThread, thirdBranch->UpdateThread);
+}
+
+
+TEST(ProcessObject, UpdateInputsConcurrentlyUpdatesDependentBranchesSerially)
+{
+  auto common = AddOneImageFilter::New();
+  common->SetInput(MakeImage(1.0f));
+  auto firstBranch = AddOneImageFilter::New();
+  firstBranch->SetInput(common->GetOutput());
+  auto secondBranch = AddOneImageFilter::New();
+  secondBranch->SetInput(common->GetOutput());
+
+  auto sum = AddOneImageFilter::New();
+  sum->SetInput(0, firstBranch->GetOutput());
+  sum->SetInput(1, secondBranch->GetOutput());
+  sum->UpdateInputsConcurrentlyOn();
+  sum->Update();
+
+  EXPECT_EQ(sum->GetOutput()->GetPixel({ { 4, 2 } }), 3.0f + 3.0f + 1.0f);
+  EXPECT_EQ(firstBranch->UpdateThread, std::this_thread::get_id());
+  EXPECT_EQ(secondBranch->UpdateThread, std::this_thread::get_id());
+}
@@ -0,0 +1,174 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+// First include the header file to be tested:
+#include "itkRunLengthImage.h"
+
+#include "itkImageRegionConstIterator.h"
+#include "itkImageScanlineConstIterator.h"
+#include "itkIndexRange.h"
+#include "itkGTest.h"
+
+namespace
+{
+using LabelImageType = itk::Image<unsigned short, 3>;
+using RunLengthImageType = itk::RunLengthImage<unsigned short, 3>;
+
+// Creates a label image made of a few boxes.
+LabelImageType::Pointer
+CreateLabelImage()
+{
+  auto image = LabelImageType::New();
+  image->SetRegions(LabelImageType::RegionType({ { -3, 2, 0 } }, { { 40, 9, 6 } }));
+  image->SetSpacing(itk::MakeVector(0.5, 1.0, 2.0));
+  image->AllocateInitialized();
+  for (const auto & index : itk::ImageRegionIndexRange<3>(image->GetBufferedRegion()))
+  {
+    if (index[0] > 5 && index[0] < 20 && index[1] < 8)
+    {
+      image->SetPixel(index, 3);
+    }
+    if (index[0] > 15 && index[2] > 2)
+    {
+      image->SetPixel(index, 7);
+    }
+  }
+  return image;
+}
+} // namespace
+
+
+TEST(RunLengthImage, EncodesAndDecodesImages)
+{
+  const auto labelImage = CreateLabelImage();
+
+  const auto image = RunLengthImageType::New();
+  image->CopyFromImage(labelImage);
+  ITK_GTEST_EXERCISE_BASIC_OBJECT_METHODS(image, RunLengthImage, ImageBase);
+
+  EXPECT_EQ(image->GetBufferedRegion(), labelImage->GetBufferedRegion());
+  EXPECT_EQ(image->GetSpacing(), labelImage->GetSpacing());
+  // Each line has at most four runs: background, 3, background or 7, and 7.
+  EXPECT_LE(image->GetNumberOfRuns(), 4u * 9u * 6u);
+
+  for (const auto & index : itk::ImageRegionIndexRange<3>(labelImage->GetBufferedRegion()))
+  {
+    EXPECT_EQ(image->GetPixel(index), labelImage->GetPixel(index));
+  }
+
+  const auto decodedImage = LabelImageType::New();
+  image->CopyToImage(decodedImage);
+  EXPECT_EQ(*decodedImage, *labelImage);
+}
+
+
+TEST(RunLengthImage, SetPixelSplitsAndMergesRuns)
+{
+  using ImageType = itk::RunLengthImage<int, 2>;
+  const auto image = ImageType::New();
+  image->SetRegions(ImageType::SizeType{ { 10, 2 } });
+  image->Allocate();
+  EXPECT_EQ(image->GetNumberOfRuns(), 2u);
+
+  image->SetPixel({ { 4, 1 } }, 5);
+  EXPECT_EQ(image->GetLine({ { 0, 1 } }).size(), 3u);
+  image->SetPixel({ { 5, 1 } }, 5);
+  image->SetPixel({ { 3, 1 } }, 5);
+  EXPECT_EQ(image->GetLine({ { 0, 1 } }).size(), 3u);
+  EXPECT_EQ(image->GetLine({ { 0, 1 } })[1].RunLength, 3);
+
+  image->SetPixel({ { 4, 1 } }, 0);
+  EXPECT_EQ(image->GetLine({ { 0, 1 } }).size(), 5u);
+  image->SetPixel({ { 4, 1 } }, 5);
+  image->SetPixel({ { 3, 1 } }, 0);
+  image->SetPixel({ { 4, 1 } }, 0);
+  image->SetPixel({ { 5, 1 } }, 0);
+  EXPECT_EQ(image->GetLine({ { 0, 1 } }).size(), 1u);
+  EXPECT_EQ(image->GetNumberOfRuns(), 2u);
+
+  image->FillBuffer(2);
+  EXPECT_EQ(image->GetPixel({ { 9, 0 } }), 2);
+
+  ImageType::LineType line{ { 4, 1 }, { 6, 8 } };
+  image->SetLine({ { 0, 0 } }, line);
+  EXPECT_EQ(image->GetPixel({ { 3, 0 } }), 1);
+  EXPECT_EQ(image->GetPixel({ { 4, 0 } }), 8);
+
+  line.pop_back();
+  EXPECT_THROW(image->SetLine({ { 0, 0 } }, line), itk::ExceptionObject);
+}
+
+
+TEST(RunLengthImage, SplitsRunsLongerThanRunLengthType)
+{
+  using ImageType = itk::RunLengthImage<unsigned char, 2, unsigned char>;
+  const auto image = ImageType::New();
+  image->SetRegions(ImageType::SizeType{ { 1000, 1 } });
+  image->Allocate();
+  EXPECT_EQ(image->GetNumberOfRuns(), 4u);
+
+  for (itk::IndexValueType i = 0; i < 1000; i += 7)
+  {
+    image->SetPixel({ { i, 0 } }, 1);
+    image->SetPixel({ { i, 0 } }, 0);
+  }
+  for (itk::IndexValueType i = 0; i < 1000; ++i)
+  {
+    ASSERT_EQ(image->GetPixel({ { i, 0 } }), 0);
+  }
+  EXPECT_EQ(image->GetNumberOfRuns(), 4u);
+}
+
+
+TEST(RunLengthImage, IteratorsDecodeRuns)
+{
+  const auto labelImage = CreateLabelImage();
+  const auto image = RunLengthImageType::New();
+  image->CopyFromImage(labelImage);
+
+  const LabelImageType::RegionType region({ { 0, 3, 1 } }, { { 30, 5, 4 } });
+
+  itk::ImageRegionConstIterator<LabelImageType> expectedIt(labelImage, region);
+  itk::ImageRegionConstIterator                 regionIt(image.GetPointer(), region);
+  for (; !expectedIt.IsAtEnd(); ++expectedIt, ++regionIt)
+  {
+    ASSERT_FALSE(regionIt.IsAtEnd());
+    EXPECT_EQ(regionIt.GetIndex(), expectedIt.GetIndex());
+    EXPECT_EQ(regionIt.Get(), expectedIt.Get());
+  }
+  EXPECT_TRUE(regionIt.IsAtEnd());
+
+  itk::ImageScanlineConstIterator scanlineIt(image.GetPointer(), region);
+  itk::SizeValueType              numberOfPixels = 0;
+  for (; !scanlineIt.IsAtEnd(); scanlineIt.NextLine())
+  {
+    while (!scanlineIt.IsAtEndOfLine())
+    {
+      // Skip whole runs at once.
+      const auto runLength = scanlineIt.GetRemainingRunLength();
+      ASSERT_GT(runLength, 0u);
+      for (itk::SizeValueType i = 0; i < runLength; ++i)
+      {
+        EXPECT_EQ(scanlineIt.Get(), labelImage->GetPixel(scanlineIt.GetIndex()));
+        ++scanlineIt;
+        ++numberOfPixels;
+      }
+    }
+  }
+  EXPECT_EQ(numberOfPixels, region.GetNumberOfPixels());
+}
@@ -0,0 +1,150 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#include "itkTraceEventRecorder.h"
+#include "itkGTest.h"
+
+#include "itkImageRegionIterator.h"
+#include "itkInPlaceImageFilter.h"
+#include <fstream>
+#include <sstream>
+
+namespace
+{
+using ImageType = itk::Image<float, 2>;
+
+class AddOneImageFilter : public itk::InPlaceImageFilter<ImageType, ImageType>
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(AddOneImageFilter);
+
+  using Self = AddOneImageFilter;
+  using Superclass = itk::InPlaceImageFilter<ImageType, ImageType>;
+  using Pointer = itk::SmartPointer<Self>;
+
+  itkNewMacro(Self);
+  itkOverrideGetNameOfClassMacro(AddOneImageFilter);
+
+protected:
+  AddOneImageFilter()
+  {
+    this->DynamicMultiThreadingOn();
+    this->InPlaceOff();
+  }
+
+  void
+  DynamicThreadedGenerateData(const OutputImageRegionType & region) override
+  {
+    for (itk::ImageRegionIterator<ImageType> outputIt(this->GetOutput(), region); !outputIt.IsAtEnd(); ++outputIt)
+    {
+      outputIt.Set(this->GetInput()->GetPixel(outputIt.GetIndex()) + 1.0f);
+    }
+  }
+};
+
+// Restores the state of the recorder at the end of a test.
+class TraceEventRecorderGuard
+{
+public:
+  TraceEventRecorderGuard()
+    : m_Enabled(itk::TraceEventRecorder::GetEnabled())
+    , m_FileName(itk::TraceEventRecorder::GetFileName())
+  {
+    itk::TraceEventRecorder::Clear();
+  }
+
+  ~TraceEventRecorderGuard()
+  {
+    itk::TraceEventRecorder::Clear();
+    itk::TraceEventRecorder::SetEnabled(m_Enabled);
+    itk::TraceEventRecorder::SetFileName(m_FileName);
+  }
+
+  ITK_DISALLOW_COPY_AND_MOVE(TraceEventRecorderGuard);
+
+private:
+  bool        m_Enabled;
+  std::string m_FileName;
+};
+
+void
+UpdatePipeline()
+{
+  auto image = ImageType::New();
+  image->SetRegions(ImageType::SizeType::Filled(64));
+  image->AllocateInitialized();
+
+  auto filter = AddOneImageFilter::New();
+  filter->SetInput(image);
+  filter->Update();
+  EXPECT_EQ(filter->GetOutput()->GetPixel({ { 3, 5 } }), 1.0f);
+}
+} // namespace
+
+
+TEST(TraceEventRecorder, RecordsNothingWhenDisabled)
+{
+  const TraceEventRecorderGuard guard;
+  itk::TraceEventRecorder::SetEnabled(false);
+
+  UpdatePipeline();
+  EXPECT_EQ(itk::TraceEventRecorder::GetNumberOfEvents(), 0u);
+}
+
+
+TEST(TraceEventRecorder, WritesPipelineEventsAsTraceEventJSON)
+{
+  const TraceEventRecorderGuard guard;
+  itk::TraceEventRecorder::SetEnabled(true);
+  const std::string fileName = testing::TempDir() + "itkTraceEventRecorderGTest.json";
+  itk::TraceEventRecorder::SetFileName(fileName);
+  EXPECT_EQ(itk::TraceEventRecorder::GetFileName(), fileName);
+
+  UpdatePipeline();
+  EXPECT_GT(itk::TraceEventRecorder::GetNumberOfEvents(), 0u);
+
+  itk::TraceEventRecorder::WriteTraceFile();
+  EXPECT_EQ(itk::TraceEventRecorder::GetNumberOfEvents(), 0u);
+
+  std::ifstream     file(fileName);
+  std::stringstream contents;
+  contents << file.rdbuf();
+  const std::string trace = contents.str();
+
+  EXPECT_EQ(trace.rfind("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[", 0), 0u);
+  EXPECT_NE(trace.find("\"cat\":\"GenerateOutputInformation\",\"name\":\"AddOneImageFilter\""), std::string::npos);
+  EXPECT_NE(trace.find("\"cat\":\"GenerateData\",\"name\":\"AddOneImageFilter\""), std::string::npos);
+  EXPECT_NE(trace.find("\"cat\":\"WorkUnit\",\"name\":\"AddOneImageFilter\""), std::string::npos);
+  EXPECT_NE(trace.find("\"cat\":\"Allocate\",\"name\":\"ImportImageContainer\",\"args\":{\"bytes\":16384}"),
+            std::string::npos);
+  EXPECT_EQ(trace.substr(trace.size() - 4), "\n]}\n");
+}
+
+
+TEST(TraceEventRecorder, RecordsEventsOfScopes)
+{
+  const TraceEventRecorderGuard guard;
+  itk::TraceEventRecorder::SetEnabled(true);
+  {
+    const itk::TraceEventScope traceEvent("Test", "Scope");
+    EXPECT_EQ(itk::TraceEventRecorder::GetNumberOfEvents(), 0u);
+  }
+  EXPECT_EQ(itk::TraceEventRecorder::GetNumberOfEvents(), 1u);
+
+  itk::TraceEventRecorder::Clear();
+  EXPECT_EQ(itk::TraceEventRecorder::GetNumberOfEvents(), 0u);
+}
@@ -0,0 +1,148 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#include "itkUpdateFuture.h"
+#include "itkGTest.h"
+
+#include "itkImageSource.h"
+#include "itkProgressReporter.h"
+#include <thread>
+
+namespace
+{
+using ImageType = itk::Image<float, 2>;
+
+// Fills its output with a value, one row at a time, taking one millisecond
+// per row, or throws when asked to.
+class SlowImageSource : public itk::ImageSource<ImageType>
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(SlowImageSource);
+
+  using Self = SlowImageSource;
+  using Superclass = itk::ImageSource<ImageType>;
+  using Pointer = itk::SmartPointer<Self>;
+
+  itkNewMacro(Self);
+  itkOverrideGetNameOfClassMacro(SlowImageSource);
+
+  itkSetMacro(Value, float);
+  itkSetMacro(NumberOfRows, itk::SizeValueType);
+  itkSetMacro(Fail, bool);
+
+protected:
+  SlowImageSource() = default;
+
+  void
+  GenerateOutputInformation() override
+  {
+    ImageType::RegionType region;
+    region.SetSize({ { 8, m_NumberOfRows } });
+    this->GetOutput()->SetLargestPossibleRegion(region);
+  }
+
+  void
+  GenerateData() override
+  {
+    if (m_Fail)
+    {
+      itkExceptionMacro("Failed as requested.");
+    }
+    ImageType * output = this->GetOutput();
+    output->SetBufferedRegion(output->GetRequestedRegion());
+    output->Allocate();
+    output->FillBuffer(m_Value);
+
+    itk::ProgressReporter progress(this, 0, m_NumberOfRows, 100);
+    for (itk::SizeValueType row = 0; row < m_NumberOfRows; ++row)
+    {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      progress.CompletedPixel();
+    }
+  }
+
+private:
+  float              m_Value{ 0.0f };
+  itk::SizeValueType m_NumberOfRows{ 10 };
+  bool               m_Fail{ false };
+};
+} // namespace
+
+
+TEST(UpdateFuture, UpdatesInAnotherThread)
+{
+  auto source = SlowImageSource::New();
+  source->SetValue(3.0f);
+
+  const itk::UpdateFuture future = source->UpdateLargestPossibleRegionAsync();
+  EXPECT_TRUE(future.IsValid());
+  EXPECT_NO_THROW(future.Get());
+  EXPECT_TRUE(future.IsReady());
+  EXPECT_EQ(future.GetProgress(), 1.0f);
+  EXPECT_FALSE(future.IsCancelled());
+  EXPECT_EQ(source->GetOutput()->GetPixel({ { 1, 1 } }), 3.0f);
+
+  EXPECT_FALSE(itk::UpdateFuture().IsValid());
+}
+
+
+TEST(UpdateFuture, RethrowsTheExceptionOfTheUpdate)
+{
+  auto source = SlowImageSource::New();
+  source->SetFail(true);
+
+  EXPECT_THROW(source->UpdateLargestPossibleRegionAsync().Get(), itk::ExceptionObject);
+
+  // The pipeline may be updated again.
+  source->SetFail(false);
+  EXPECT_NO_THROW(source->UpdateLargestPossibleRegionAsync().Get());
+}
+
+
+TEST(UpdateFuture, Cancel)
+{
+  auto source = SlowImageSource::New();
+  source->SetNumberOfRows(5000);
+
+  itk::UpdateFuture future = source->UpdateLargestPossibleRegionAsync();
+  while (future.GetProgress() == 0.0f && !future.IsReady())
+  {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  future.Cancel();
+  EXPECT_TRUE(future.IsCancelled());
+  EXPECT_TRUE(future.WaitFor(std::chrono::seconds(30)));
+  EXPECT_THROW(future.Get(), itk::ProcessAborted);
+}
+
+
+TEST(UpdateFuture, RunsSeveralPipelinesConcurrently)
+{
+  std::vector<SlowImageSource::Pointer> sources;
+  std::vector<itk::UpdateFuture>        futures;
+  for (unsigned int i = 0; i < 2 * itk::UpdateFuture::GetMaximumNumberOfConcurrentUpdates(); ++i)
+  {
+    sources.push_back(SlowImageSource::New());
+    sources.back()->SetValue(static_cast<float>(i));
+    futures.push_back(sources.back()->UpdateLargestPossibleRegionAsync());
+  }
+  for (unsigned int i = 0; i < futures.size(); ++i)
+  {
+    EXPECT_NO_THROW(futures[i].Get());
+    EXPECT_EQ(sources[i]->GetOutput()->GetPixel({ { 2, 3 } }), static_cast<float>(i));
+  }
+}
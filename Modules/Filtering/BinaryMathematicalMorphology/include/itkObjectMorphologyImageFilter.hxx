@@ -19,8 +19,12 @@
 #define itkObjectMorphologyImageFilter_hxx
 
 
+#include <algorithm> // For any_of.
 #include <climits>
 #include "itkNumericTraits.h"
+#include "itkConstantBoundaryImageNeighborhoodPixelAccessPolicy.h"
+#include "itkImageNeighborhoodOffsets.h"
+#include "itkIndexRange.h"
 #include "itkNeighborhoodAlgorithm.h"
 #include "itkTotalProgressReporter.h"
 #include "itkImageRegionConstIterator.h"
@@ -119,12 +123,6 @@ void
 ObjectMorphologyImageFilter<TInputImage, TOutputImage, TKernel>::DynamicThreadedGenerateData(
   const OutputImageRegionType & outputRegionForThread)
 {
-  // Find the boundary "faces"
-  NeighborhoodAlgorithm::ImageBoundaryFacesCalculator<InputImageType>                              fC;
-  const typename NeighborhoodAlgorithm::ImageBoundaryFacesCalculator<InputImageType>::FaceListType faceList =
-    fC(this->GetInput(), outputRegionForThread, m_Kernel.GetRadius());
-
-
   // Setup the kernel that spans the immediate neighbors of the current
   // input pixel - used to determine if that pixel abuts a non-object
   // pixel, i.e., is a boundary pixel
@@ -132,6 +130,49 @@ ObjectMorphologyImageFilter<TInputImage, TOutputImage, TKernel>::DynamicThreaded
 
   TotalProgressReporter progress(this, this->GetOutput()->GetRequestedRegion().GetNumberOfPixels());
 
+  // Without boundary condition, the pixels outside the image are ignored, which
+  // is equivalent to a constant boundary equal to the object value. The
+  // (default) constant boundary condition is handled the same way, so that
+  // only the boundary faces need bounds checking.
+  const auto * const constantBoundaryCondition =
+    dynamic_cast<const ConstantBoundaryCondition<InputImageType> *>(m_BoundaryCondition);
+  if (!m_UseBoundaryCondition || constantBoundaryCondition != nullptr)
+  {
+    const PixelType outsideValue = m_UseBoundaryCondition ? constantBoundaryCondition->GetConstant() : m_ObjectValue;
+
+    NeighborhoodAlgorithm::ProcessNonBoundaryRegionAndBoundaryFaces<ConstantBoundaryImageNeighborhoodPixelAccessPolicy>(
+      *(this->GetInput()),
+      outputRegionForThread,
+      GenerateRectangularImageNeighborhoodOffsets(bKernelSize),
+      [this, &progress](const auto & region, auto & neighborhoodRange) {
+        OutputNeighborhoodIteratorType oSNIter(m_Kernel.GetRadius(), this->GetOutput(), region);
+        oSNIter.GoToBegin();
+
+        for (const auto & index : MakeIndexRange(region))
+        {
+          if (Math::ExactlyEquals(this->GetInput()->GetPixel(index), m_ObjectValue))
+          {
+            neighborhoodRange.SetLocation(index);
+            if (std::any_of(neighborhoodRange.cbegin(), neighborhoodRange.cend(), [this](const PixelType pixel) {
+                  return Math::NotExactlyEquals(pixel, m_ObjectValue);
+                }))
+            {
+              this->Evaluate(oSNIter, m_Kernel);
+            }
+          }
+          ++oSNIter;
+          progress.CompletedPixel();
+        }
+      },
+      outsideValue);
+    return;
+  }
+
+  // Find the boundary "faces"
+  NeighborhoodAlgorithm::ImageBoundaryFacesCalculator<InputImageType>                              fC;
+  const typename NeighborhoodAlgorithm::ImageBoundaryFacesCalculator<InputImageType>::FaceListType faceList =
+    fC(this->GetInput(), outputRegionForThread, m_Kernel.GetRadius());
+
   OutputNeighborhoodIteratorType oSNIter;
   InputNeighborhoodIteratorType  iSNIter;
   for (const auto & face : faceList)
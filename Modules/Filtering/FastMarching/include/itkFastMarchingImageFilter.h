@@ -20,13 +20,11 @@
 
 #include "itkImageToImageFilter.h"
 #include "itkImageRegionConstIteratorWithIndex.h"
+#include "itkIndexedMinHeap.h"
 #include "itkLevelSet.h"
 #include "itkMath.h"
 #include "ITKFastMarchingExport.h"
 
-#include <functional>
-#include <queue>
-
 namespace itk
 {
 /** \class FastMarchingImageFilterEnums
@@ -67,8 +65,8 @@ extern ITKFastMarching_EXPORT std::ostream &
  *
  * Updates are performed using an entropy satisfy scheme where only
  * "upwind" neighborhoods are used. This implementation of Fast Marching
- * uses a std::priority_queue to locate the next proper grid position to
- * update.
+ * uses an IndexedMinHeap, keyed by the offsets of the trial points in the
+ * output buffer, to locate the next proper grid position to update.
  *
  * Fast Marching sweeps through N grid points in (N log N) steps to obtain
  * the arrival time value as the front propagates through the grid.
@@ -112,17 +110,9 @@ extern ITKFastMarching_EXPORT std::ostream &
  *
  * For an alternative implementation, see itk::FastMarchingImageFilter.
  *
- * Possible Improvements:
- * In the current implementation, std::priority_queue only allows
- * taking nodes out from the front and putting nodes in from the back.
- * To update a value already on the heap, a new node is added to the heap.
- * The defunct old node is left on the heap. When it is removed from the
- * top, it will be recognized as invalid and not used.
- * Future implementations can implement the heap in a different way
- * allowing the values to be updated. This will generally require
- * some sift-up and sift-down functions and
- * an image of back-pointers going from the image to heap in order
- * to locate the node which is to be updated.
+ * When the value of a trial point is updated, its key is changed in place in
+ * the heap, so that the heap holds each trial point once, and every point
+ * taken from the heap is valid.
  *
  * \sa FastMarchingImageFilterBase
  * \sa LevelSetTypeDefault
@@ -451,12 +441,10 @@ private:
   typename LevelSetImageType::PixelType m_LargeValue{};
   AxisNodeType                          m_NodesUsed[SetDimension]{};
 
-  /** Trial points are stored in a min-heap. This allow efficient access
-   * to the trial point with minimum value which is the next grid point
-   * the algorithm processes. */
-  using HeapContainer = std::vector<AxisNodeType>;
-  using NodeComparer = std::greater<AxisNodeType>;
-  using HeapType = std::priority_queue<AxisNodeType, HeapContainer, NodeComparer>;
+  /** Trial points are stored in a min-heap, by their offset in the output
+   * buffer. This allow efficient access to the trial point with minimum value
+   * which is the next grid point the algorithm processes. */
+  using HeapType = IndexedMinHeap<PixelType>;
 
   HeapType m_TrialHeap{};
 
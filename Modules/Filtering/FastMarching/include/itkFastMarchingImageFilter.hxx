@@ -184,10 +184,7 @@ FastMarchingImageFilter<TLevelSet, TSpeedImage>::Initialize(LevelSetImageType *
   }
 
   // make sure the heap is empty
-  while (!m_TrialHeap.empty())
-  {
-    m_TrialHeap.pop();
-  }
+  m_TrialHeap.Initialize(m_BufferedRegion.GetNumberOfPixels());
 
   // process the input trial points
   if (m_TrialPoints)
@@ -209,7 +206,7 @@ FastMarchingImageFilter<TLevelSet, TSpeedImage>::Initialize(LevelSetImageType *
 
         output->SetPixel(idx, node.GetValue());
 
-        m_TrialHeap.push(node);
+        m_TrialHeap.Push(static_cast<SizeValueType>(output->ComputeOffset(idx)), node.GetValue());
       }
       ++pointsIter;
     }
@@ -244,53 +241,46 @@ FastMarchingImageFilter<TLevelSet, TSpeedImage>::GenerateData()
   this->UpdateProgress(0.0); // Send first progress event
 
   // CACHE
-  while (!m_TrialHeap.empty())
+  while (!m_TrialHeap.IsEmpty())
   {
     // get the node with the smallest value
-    AxisNodeType node = m_TrialHeap.top();
-    m_TrialHeap.pop();
+    AxisNodeType node;
+    node.SetIndex(output->ComputeIndex(static_cast<OffsetValueType>(m_TrialHeap.GetTopElement())));
+    node.SetValue(m_TrialHeap.GetTopKey());
+    m_TrialHeap.Pop();
 
-    // does this node contain the current value ?
-    auto currentValue = static_cast<double>(output->GetPixel(node.GetIndex()));
-
-    if (Math::ExactlyEquals(node.GetValue(), currentValue))
+    const auto currentValue = static_cast<double>(node.GetValue());
+    if (currentValue > m_StoppingValue)
     {
-      // is this node already alive ?
-      if (m_LabelImage->GetPixel(node.GetIndex()) != LabelEnum::AlivePoint)
-      {
-        if (currentValue > m_StoppingValue)
-        {
-          this->UpdateProgress(1.0);
-          break;
-        }
+      this->UpdateProgress(1.0);
+      break;
+    }
 
-        if (m_CollectPoints)
-        {
-          m_ProcessedPoints->InsertElement(m_ProcessedPoints->Size(), node);
-        }
+    if (m_CollectPoints)
+    {
+      m_ProcessedPoints->InsertElement(m_ProcessedPoints->Size(), node);
+    }
 
-        // set this node as alive
-        m_LabelImage->SetPixel(node.GetIndex(), LabelEnum::AlivePoint);
+    // set this node as alive
+    m_LabelImage->SetPixel(node.GetIndex(), LabelEnum::AlivePoint);
 
-        // update its neighbors
-        this->UpdateNeighbors(node.GetIndex(), speedImage, output);
+    // update its neighbors
+    this->UpdateNeighbors(node.GetIndex(), speedImage, output);
 
-        // Send events every certain number of points.
-        const double newProgress = currentValue / m_StoppingValue;
-        if (newProgress - oldProgress > 0.01) // update every 1%
-        {
-          this->UpdateProgress(newProgress);
-          oldProgress = newProgress;
-          if (this->GetAbortGenerateData())
-          {
-            this->InvokeEvent(AbortEvent());
-            this->ResetPipeline();
-            ProcessAborted e(__FILE__, __LINE__);
-            e.SetDescription("Process aborted.");
-            e.SetLocation(ITK_LOCATION);
-            throw e;
-          }
-        }
+    // Send events every certain number of points.
+    const double newProgress = currentValue / m_StoppingValue;
+    if (newProgress - oldProgress > 0.01) // update every 1%
+    {
+      this->UpdateProgress(newProgress);
+      oldProgress = newProgress;
+      if (this->GetAbortGenerateData())
+      {
+        this->InvokeEvent(AbortEvent());
+        this->ResetPipeline();
+        ProcessAborted e(__FILE__, __LINE__);
+        e.SetDescription("Process aborted.");
+        e.SetLocation(ITK_LOCATION);
+        throw e;
       }
     }
   }
@@ -302,36 +292,33 @@ FastMarchingImageFilter<TLevelSet, TSpeedImage>::UpdateNeighbors(const IndexType
                                                                  const SpeedImageType * speedImage,
                                                                  LevelSetImageType *    output)
 {
-  IndexType neighIndex = index;
+  // The labels of the neighbors are read directly from the label buffer,
+  // which has the buffered region of the output.
+  const LabelEnum *       labels = m_LabelImage->GetBufferPointer();
+  const OffsetValueType * offsetTable = output->GetOffsetTable();
+  const OffsetValueType   offset = output->ComputeOffset(index);
+
+  const auto isUpdatable = [labels](const OffsetValueType neighOffset) {
+    const LabelEnum label = labels[neighOffset];
+    return (label != LabelEnum::AlivePoint) && (label != LabelEnum::InitialTrialPoint) &&
+           (label != LabelEnum::OutsidePoint);
+  };
 
+  IndexType neighIndex = index;
 
   for (unsigned int j = 0; j < SetDimension; ++j)
   {
     // update left neighbor
-    if (index[j] > m_StartIndex[j])
+    if (index[j] > m_StartIndex[j] && isUpdatable(offset - offsetTable[j]))
     {
       neighIndex[j] = index[j] - 1;
-    }
-
-    LabelEnum label = m_LabelImage->GetPixel(neighIndex);
-
-    if ((label != LabelEnum::AlivePoint) && (label != LabelEnum::InitialTrialPoint) &&
-        (label != LabelEnum::OutsidePoint))
-    {
       this->UpdateValue(neighIndex, speedImage, output);
     }
 
     // update right neighbor
-    if (index[j] < m_LastIndex[j])
+    if (index[j] < m_LastIndex[j] && isUpdatable(offset + offsetTable[j]))
     {
       neighIndex[j] = index[j] + 1;
-    }
-
-    label = m_LabelImage->GetPixel(neighIndex);
-
-    if ((label != LabelEnum::AlivePoint) && (label != LabelEnum::InitialTrialPoint) &&
-        (label != LabelEnum::OutsidePoint))
-    {
       this->UpdateValue(neighIndex, speedImage, output);
     }
 
@@ -350,6 +337,13 @@ FastMarchingImageFilter<TLevelSet, TSpeedImage>::UpdateValue(const IndexType &
 
   PixelType neighValue;
 
+  // The labels and values of the neighbors are read directly from the
+  // buffers, which have the same buffered region.
+  LabelEnum *             labels = m_LabelImage->GetBufferPointer();
+  PixelType *             values = output->GetBufferPointer();
+  const OffsetValueType * offsetTable = output->GetOffsetTable();
+  const OffsetValueType   offset = output->ComputeOffset(index);
+
   // just to make sure the index is initialized (really cautious)
   AxisNodeType node;
   node.SetIndex(index);
@@ -369,9 +363,10 @@ FastMarchingImageFilter<TLevelSet, TSpeedImage>::UpdateValue(const IndexType &
         continue;
       }
 
-      if (m_LabelImage->GetPixel(neighIndex) == LabelEnum::AlivePoint)
+      const OffsetValueType neighOffset = offset + s * offsetTable[j];
+      if (labels[neighOffset] == LabelEnum::AlivePoint)
       {
-        neighValue = static_cast<PixelType>(output->GetPixel(neighIndex));
+        neighValue = values[neighOffset];
 
         // let's find the minimum value given a direction j
         if (node.GetValue() > neighValue)
@@ -446,13 +441,11 @@ FastMarchingImageFilter<TLevelSet, TSpeedImage>::UpdateValue(const IndexType &
   {
     // write solution to m_OutputLevelSet
     auto outputPixel = static_cast<PixelType>(solution);
-    output->SetPixel(index, outputPixel);
+    values[offset] = outputPixel;
 
-    // insert point into trial heap
-    m_LabelImage->SetPixel(index, LabelEnum::TrialPoint);
-    node.SetValue(outputPixel);
-    node.SetIndex(index);
-    m_TrialHeap.push(node);
+    // insert point into trial heap, or update its value in the heap
+    labels[offset] = LabelEnum::TrialPoint;
+    m_TrialHeap.Push(static_cast<SizeValueType>(offset), outputPixel);
   }
 
   return solution;
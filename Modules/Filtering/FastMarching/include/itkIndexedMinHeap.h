@@ -0,0 +1,218 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkIndexedMinHeap_h
+#define itkIndexedMinHeap_h
+
+#include "itkIntTypes.h"
+#include "itkNumericTraits.h"
+
+#include <algorithm> // For min.
+#include <cassert>
+#include <vector>
+
+namespace itk
+{
+
+/**
+ * \class IndexedMinHeap
+ * \brief Min-heap of elements identified by an integer in [0, N), whose keys
+ * can be changed while they are in the heap.
+ *
+ * The heap keeps the position of each element, so that Push() of an element
+ * which is already in the heap changes its key in place (decrease-key, or
+ * increase-key), instead of adding a duplicate. The elements are typically
+ * the offsets of pixels in an image buffer, and N the number of pixels.
+ *
+ * The heap is 4-ary, which halves its depth compared to a binary heap, and
+ * stores the keys next to the element identifiers, so that the children of
+ * a node are compared without any indirection.
+ *
+ * \ingroup ITKFastMarching
+ */
+template <typename TKey>
+class IndexedMinHeap
+{
+public:
+  using KeyType = TKey;
+  using ElementIdentifier = SizeValueType;
+
+  /** Empties the heap, and allows elements identified by [0, numberOfElements). */
+  void
+  Initialize(SizeValueType numberOfElements)
+  {
+    m_Nodes.clear();
+    m_Positions.assign(numberOfElements, NotInHeap);
+  }
+
+  /** Tells whether the heap has no element. */
+  [[nodiscard]] bool
+  IsEmpty() const
+  {
+    return m_Nodes.empty();
+  }
+
+  /** Returns the number of elements in the heap. */
+  [[nodiscard]] SizeValueType
+  GetSize() const
+  {
+    return m_Nodes.size();
+  }
+
+  /** Tells whether an element is in the heap. */
+  [[nodiscard]] bool
+  Contains(ElementIdentifier element) const
+  {
+    return m_Positions[element] != NotInHeap;
+  }
+
+  /** Adds an element with the specified key, or changes its key if it is
+   * already in the heap. */
+  void
+  Push(ElementIdentifier element, const KeyType & key)
+  {
+    SizeValueType position = m_Positions[element];
+    if (position == NotInHeap)
+    {
+      position = m_Nodes.size();
+      m_Nodes.push_back(NodeType{ key, element });
+      this->SiftUp(position);
+    }
+    else if (key < m_Nodes[position].Key)
+    {
+      m_Nodes[position].Key = key;
+      this->SiftUp(position);
+    }
+    else
+    {
+      m_Nodes[position].Key = key;
+      this->SiftDown(position);
+    }
+  }
+
+  /** Returns the element with the lowest key. The heap must not be empty. */
+  [[nodiscard]] ElementIdentifier
+  GetTopElement() const
+  {
+    assert(!this->IsEmpty());
+    return m_Nodes.front().Element;
+  }
+
+  /** Returns the lowest key. The heap must not be empty. */
+  [[nodiscard]] const KeyType &
+  GetTopKey() const
+  {
+    assert(!this->IsEmpty());
+    return m_Nodes.front().Key;
+  }
+
+  /** Removes the element with the lowest key. The heap must not be empty. */
+  void
+  Pop()
+  {
+    assert(!this->IsEmpty());
+    m_Positions[m_Nodes.front().Element] = NotInHeap;
+    if (m_Nodes.size() > 1)
+    {
+      m_Nodes.front() = m_Nodes.back();
+      m_Nodes.pop_back();
+      this->SiftDown(0);
+    }
+    else
+    {
+      m_Nodes.pop_back();
+    }
+  }
+
+private:
+  static constexpr SizeValueType NotInHeap = NumericTraits<SizeValueType>::max();
+  static constexpr SizeValueType Arity = 4;
+
+  struct NodeType
+  {
+    KeyType           Key;
+    ElementIdentifier Element;
+  };
+
+  /** Moves the node at the specified position up, until its parent has a
+   * lower or equal key. */
+  void
+  SiftUp(SizeValueType position)
+  {
+    const NodeType node = m_Nodes[position];
+    while (position > 0)
+    {
+      const SizeValueType parent = (position - 1) / Arity;
+      if (!(node.Key < m_Nodes[parent].Key))
+      {
+        break;
+      }
+      this->Place(m_Nodes[parent], position);
+      position = parent;
+    }
+    this->Place(node, position);
+  }
+
+  /** Moves the node at the specified position down, until its children have
+   * higher or equal keys. */
+  void
+  SiftDown(SizeValueType position)
+  {
+    const NodeType      node = m_Nodes[position];
+    const SizeValueType size = m_Nodes.size();
+    for (;;)
+    {
+      const SizeValueType firstChild = position * Arity + 1;
+      if (firstChild >= size)
+      {
+        break;
+      }
+      const SizeValueType lastChild = std::min(firstChild + Arity, size);
+
+      SizeValueType minimumChild = firstChild;
+      for (SizeValueType child = firstChild + 1; child < lastChild; ++child)
+      {
+        if (m_Nodes[child].Key < m_Nodes[minimumChild].Key)
+        {
+          minimumChild = child;
+        }
+      }
+      if (!(m_Nodes[minimumChild].Key < node.Key))
+      {
+        break;
+      }
+      this->Place(m_Nodes[minimumChild], position);
+      position = minimumChild;
+    }
+    this->Place(node, position);
+  }
+
+  /** Stores a node at the specified position, and records that position. */
+  void
+  Place(const NodeType & node, SizeValueType position)
+  {
+    m_Nodes[position] = node;
+    m_Positions[node.Element] = position;
+  }
+
+  std::vector<NodeType>      m_Nodes{};
+  std::vector<SizeValueType> m_Positions{};
+};
+
+} // end namespace itk
+
+#endif
@@ -0,0 +1,106 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+// First include the header file to be tested:
+#include "itkIndexedMinHeap.h"
+
+#include <gtest/gtest.h>
+#include <iterator> // For next.
+#include <random>
+#include <set>
+#include <utility> // For pair.
+#include <vector>
+
+// Pushes elements with random keys, changes the keys of some of them while they are in the heap, and checks that the
+// elements are popped in the order of a set of (key, element) pairs.
+TEST(IndexedMinHeap, PopsLowestKeyAfterKeyChanges)
+{
+  constexpr itk::SizeValueType numberOfElements = 1000;
+
+  itk::IndexedMinHeap<double>                       heap;
+  std::vector<double>                               keys(numberOfElements);
+  std::set<std::pair<double, itk::SizeValueType>>   expected;
+  std::mt19937                                      randomNumberEngine(42);
+  std::uniform_real_distribution<double>            keyDistribution(0.0, 100.0);
+  std::uniform_int_distribution<itk::SizeValueType> elementDistribution(0, numberOfElements - 1);
+
+  heap.Initialize(numberOfElements);
+  EXPECT_TRUE(heap.IsEmpty());
+
+  const auto push = [&](const itk::SizeValueType element, const double key) {
+    if (heap.Contains(element))
+    {
+      expected.erase({ keys[element], element });
+    }
+    heap.Push(element, key);
+    keys[element] = key;
+    expected.insert({ key, element });
+  };
+
+  for (int i = 0; i < 2000; ++i)
+  {
+    push(elementDistribution(randomNumberEngine), keyDistribution(randomNumberEngine));
+  }
+  EXPECT_EQ(heap.GetSize(), expected.size());
+
+  while (!heap.IsEmpty())
+  {
+    ASSERT_FALSE(expected.empty());
+    EXPECT_EQ(heap.GetTopKey(), expected.begin()->first);
+    EXPECT_EQ(heap.GetTopElement(), expected.begin()->second);
+    const double lowestKey = heap.GetTopKey();
+    expected.erase(expected.begin());
+    heap.Pop();
+
+    // Decrease and increase the keys of some of the remaining elements, never below the key just popped.
+    if (!expected.empty() && expected.size() % 3 == 0)
+    {
+      const itk::SizeValueType element = std::next(expected.begin(), expected.size() / 2)->second;
+      push(element, lowestKey + keyDistribution(randomNumberEngine) / 10.0);
+    }
+  }
+  EXPECT_TRUE(expected.empty());
+}
+
+
+TEST(IndexedMinHeap, KeepsEachElementOnce)
+{
+  itk::IndexedMinHeap<float> heap;
+  heap.Initialize(10);
+  heap.Push(3, 5.0f);
+  heap.Push(7, 2.0f);
+  heap.Push(3, 1.0f);
+  heap.Push(7, 4.0f);
+  EXPECT_EQ(heap.GetSize(), 2u);
+  EXPECT_TRUE(heap.Contains(3));
+  EXPECT_FALSE(heap.Contains(4));
+
+  EXPECT_EQ(heap.GetTopElement(), 3u);
+  EXPECT_EQ(heap.GetTopKey(), 1.0f);
+  heap.Pop();
+  EXPECT_FALSE(heap.Contains(3));
+  EXPECT_EQ(heap.GetTopElement(), 7u);
+  EXPECT_EQ(heap.GetTopKey(), 4.0f);
+  heap.Pop();
+  EXPECT_TRUE(heap.IsEmpty());
+
+  heap.Push(3, 6.0f);
+  heap.Initialize(10);
+  EXPECT_TRUE(heap.IsEmpty());
+  EXPECT_FALSE(heap.Contains(3));
+}
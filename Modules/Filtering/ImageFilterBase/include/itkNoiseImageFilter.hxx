@@ -18,11 +18,10 @@
 #ifndef itkNoiseImageFilter_hxx
 #define itkNoiseImageFilter_hxx
 
-#include "itkConstNeighborhoodIterator.h"
-#include "itkNeighborhoodInnerProduct.h"
-#include "itkImageRegionIterator.h"
+#include "itkImageNeighborhoodOffsets.h"
+#include "itkImageRegionRange.h"
+#include "itkIndexRange.h"
 #include "itkNeighborhoodAlgorithm.h"
-#include "itkOffset.h"
 #include "itkTotalProgressReporter.h"
 
 namespace itk
@@ -39,51 +38,41 @@ void
 NoiseImageFilter<TInputImage, TOutputImage>::DynamicThreadedGenerateData(
   const OutputImageRegionType & outputRegionForThread)
 {
-  ZeroFluxNeumannBoundaryCondition<InputImageType> nbc;
-
   // Allocate output
   const typename OutputImageType::Pointer     output = this->GetOutput();
   const typename InputImageType::ConstPointer input = this->GetInput();
 
-  // Find the data-set boundary "faces"
-  NeighborhoodAlgorithm::ImageBoundaryFacesCalculator<InputImageType>                              bC;
-  const typename NeighborhoodAlgorithm::ImageBoundaryFacesCalculator<InputImageType>::FaceListType faceList =
-    bC(input, outputRegionForThread, this->GetRadius());
+  const auto neighborhoodOffsets = GenerateRectangularImageNeighborhoodOffsets<InputImageDimension>(this->GetRadius());
+  const auto num = static_cast<InputRealType>(neighborhoodOffsets.size());
 
   TotalProgressReporter progress(this, output->GetRequestedRegion().GetNumberOfPixels());
 
-  // Process each of the boundary faces.  These are N-d regions which border
-  // the edge of the buffer.
-  for (const auto & face : faceList)
-  {
-    ConstNeighborhoodIterator<InputImageType> bit(this->GetRadius(), input, face);
-    const unsigned int                        neighborhoodSize = bit.Size();
-    auto                                      num = static_cast<InputRealType>(bit.Size());
-
-    ImageRegionIterator it(output, face);
-    bit.OverrideBoundaryCondition(&nbc);
-    bit.GoToBegin();
+  // Process the non-boundary subregion without boundary checks, and the
+  // boundary "faces" with zero flux Neumann boundary conditions.
+  NeighborhoodAlgorithm::ProcessNonBoundaryRegionAndBoundaryFaces(
+    *input, outputRegionForThread, neighborhoodOffsets, [&](const auto & region, auto & neighborhoodRange) {
+      auto outputIterator = ImageRegionRange<OutputImageType>(*output, region).begin();
 
-    while (!bit.IsAtEnd())
-    {
-      auto sum = InputRealType{};
-      auto sumOfSquares = InputRealType{};
-      for (unsigned int i = 0; i < neighborhoodSize; ++i)
+      for (const auto & index : MakeIndexRange(region))
       {
-        auto value = static_cast<InputRealType>(bit.GetPixel(i));
-        sum += value;
-        sumOfSquares += (value * value);
-      }
+        neighborhoodRange.SetLocation(index);
 
-      // calculate the standard deviation value
-      InputRealType var = (sumOfSquares - (sum * sum / num)) / (num - 1.0);
-      it.Set(static_cast<OutputPixelType>(std::sqrt(var)));
+        auto sum = InputRealType{};
+        auto sumOfSquares = InputRealType{};
+        for (const InputPixelType pixelValue : neighborhoodRange)
+        {
+          const auto value = static_cast<InputRealType>(pixelValue);
+          sum += value;
+          sumOfSquares += (value * value);
+        }
 
-      ++bit;
-      ++it;
-      progress.CompletedPixel();
-    }
-  }
+        // calculate the standard deviation value
+        const InputRealType var = (sumOfSquares - (sum * sum / num)) / (num - 1.0);
+        *outputIterator = static_cast<OutputPixelType>(std::sqrt(var));
+        ++outputIterator;
+        progress.CompletedPixel();
+      }
+    });
 }
 } // end namespace itk
 
@@ -104,20 +104,20 @@ protected:
   DynamicThreadedGenerateData(const OutputImageRegionType & outputRegionForThread) override;
 
 private:
-  template <typename TPixelAccessPolicy, typename TPixelType>
+  template <typename TNeighborhoodRange, typename TPixelType>
   static void
-  GenerateDataInSubregion(const TInputImage &                              inputImage,
-                          TOutputImage &                                   outputImage,
-                          const ImageRegion<InputImageDimension> &         imageRegion,
-                          const std::vector<Offset<InputImageDimension>> & neighborhoodOffsets,
+  GenerateDataInSubregion(const TInputImage &                      inputImage,
+                          TOutputImage &                           outputImage,
+                          const ImageRegion<InputImageDimension> & imageRegion,
+                          TNeighborhoodRange &                     neighborhoodRange,
                           const TPixelType *);
 
-  template <typename TPixelAccessPolicy, typename TValue>
+  template <typename TNeighborhoodRange, typename TValue>
   static void
-  GenerateDataInSubregion(const TInputImage &                              inputImage,
-                          TOutputImage &                                   outputImage,
-                          const ImageRegion<InputImageDimension> &         imageRegion,
-                          const std::vector<Offset<InputImageDimension>> & neighborhoodOffsets,
+  GenerateDataInSubregion(const TInputImage &                      inputImage,
+                          TOutputImage &                           outputImage,
+                          const ImageRegion<InputImageDimension> & imageRegion,
+                          TNeighborhoodRange &                     neighborhoodRange,
                           const VariableLengthVector<TValue> *);
 };
 } // end namespace itk
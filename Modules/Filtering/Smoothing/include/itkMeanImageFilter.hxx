@@ -18,13 +18,10 @@
 #ifndef itkMeanImageFilter_hxx
 #define itkMeanImageFilter_hxx
 
-#include "itkBufferedImageNeighborhoodPixelAccessPolicy.h"
 #include "itkImageNeighborhoodOffsets.h"
 #include "itkImageRegionRange.h"
 #include "itkIndexRange.h"
 #include "itkNeighborhoodAlgorithm.h"
-#include "itkOffset.h"
-#include "itkShapedImageNeighborhoodRange.h"
 #include "itkDefaultConvertPixelTraits.h"
 
 namespace itk
@@ -43,46 +40,28 @@ MeanImageFilter<TInputImage, TOutputImage>::DynamicThreadedGenerateData(
   const typename OutputImageType::Pointer     output = this->GetOutput();
   const typename InputImageType::ConstPointer input = this->GetInput();
 
-  const auto radius = this->GetRadius();
+  const auto neighborhoodOffsets = GenerateRectangularImageNeighborhoodOffsets<InputImageDimension>(this->GetRadius());
 
-  // Find the data-set boundary "faces" and the center non-boundary subregion.
-  const auto calculatorResult =
-    NeighborhoodAlgorithm::ImageBoundaryFacesCalculator<InputImageType>::Compute(*input, outputRegionForThread, radius);
-
-  const auto neighborhoodOffsets = GenerateRectangularImageNeighborhoodOffsets<InputImageDimension>(radius);
-
-  // Process the non-boundary subregion, using a faster pixel access policy without boundary extrapolation.
-  GenerateDataInSubregion<BufferedImageNeighborhoodPixelAccessPolicy<InputImageType>>(
-    *input,
-    *output,
-    calculatorResult.GetNonBoundaryRegion(),
-    neighborhoodOffsets,
-    static_cast<InputPixelType *>(nullptr));
-
-  // Process each of the boundary faces. These are N-d regions which border
-  // the edge of the buffer.
-  for (const auto & boundaryFace : calculatorResult.GetBoundaryFaces())
-  {
-    GenerateDataInSubregion<ZeroFluxNeumannImageNeighborhoodPixelAccessPolicy<InputImageType>>(
-      *input, *output, boundaryFace, neighborhoodOffsets, static_cast<InputPixelType *>(nullptr));
-  }
+  // Process the non-boundary subregion without boundary extrapolation, and
+  // the boundary faces with zero flux Neumann boundary conditions.
+  NeighborhoodAlgorithm::ProcessNonBoundaryRegionAndBoundaryFaces(
+    *input, outputRegionForThread, neighborhoodOffsets, [&input, &output](const auto & region, auto & neighborhoodRange) {
+      GenerateDataInSubregion(*input, *output, region, neighborhoodRange, static_cast<InputPixelType *>(nullptr));
+    });
 }
 
 
 template <typename TInputImage, typename TOutputImage>
-template <typename TPixelAccessPolicy, typename TPixelType>
+template <typename TNeighborhoodRange, typename TPixelType>
 void
-MeanImageFilter<TInputImage, TOutputImage>::GenerateDataInSubregion(
-  const TInputImage &                              inputImage,
-  TOutputImage &                                   outputImage,
-  const ImageRegion<InputImageDimension> &         imageRegion,
-  const std::vector<Offset<InputImageDimension>> & neighborhoodOffsets,
-  const TPixelType *)
+MeanImageFilter<TInputImage, TOutputImage>::GenerateDataInSubregion(const TInputImage &,
+                                                                    TOutputImage &                           outputImage,
+                                                                    const ImageRegion<InputImageDimension> & imageRegion,
+                                                                    TNeighborhoodRange & neighborhoodRange,
+                                                                    const TPixelType *)
 {
-  const auto neighborhoodSize = static_cast<double>(neighborhoodOffsets.size());
+  const auto neighborhoodSize = static_cast<double>(neighborhoodRange.size());
 
-  auto neighborhoodRange = ShapedImageNeighborhoodRange<const InputImageType, TPixelAccessPolicy>(
-    inputImage, Index<InputImageDimension>(), neighborhoodOffsets);
   auto outputIterator = ImageRegionRange<OutputImageType>(outputImage, imageRegion).begin();
 
   for (const auto & index : MakeIndexRange(imageRegion))
@@ -103,19 +82,17 @@ MeanImageFilter<TInputImage, TOutputImage>::GenerateDataInSubregion(
 }
 
 template <typename TInputImage, typename TOutputImage>
-template <typename TPixelAccessPolicy, typename TValueType>
+template <typename TNeighborhoodRange, typename TValueType>
 void
 MeanImageFilter<TInputImage, TOutputImage>::GenerateDataInSubregion(
-  const TInputImage &                              inputImage,
-  TOutputImage &                                   outputImage,
-  const ImageRegion<InputImageDimension> &         imageRegion,
-  const std::vector<Offset<InputImageDimension>> & neighborhoodOffsets,
+  const TInputImage &                      inputImage,
+  TOutputImage &                           outputImage,
+  const ImageRegion<InputImageDimension> & imageRegion,
+  TNeighborhoodRange &                     neighborhoodRange,
   const VariableLengthVector<TValueType> *)
 {
-  const auto neighborhoodSize = static_cast<double>(neighborhoodOffsets.size());
+  const auto neighborhoodSize = static_cast<double>(neighborhoodRange.size());
 
-  auto neighborhoodRange = ShapedImageNeighborhoodRange<const InputImageType, TPixelAccessPolicy>(
-    inputImage, Index<InputImageDimension>(), neighborhoodOffsets);
   auto outputIterator = ImageRegionRange<OutputImageType>(outputImage, imageRegion).begin();
 
   // These temp variable are needed outside the loop for
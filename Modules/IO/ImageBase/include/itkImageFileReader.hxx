@@ -27,6 +27,7 @@
 
 #include "itksys/SystemTools.hxx"
 #include "itkMakeUniqueForOverwrite.h"
+#include "itkTraceEventRecorder.h"
 #include <fstream>
 
 namespace itk
@@ -391,6 +392,8 @@ ImageFileReader<TOutputImage, ConvertPixelTraits>::GenerateData()
   const size_t sizeOfActualIORegion =
     m_ActualIORegion.GetNumberOfPixels() * (m_ImageIO->GetComponentSize() * m_ImageIO->GetNumberOfComponents());
 
+  const TraceEventScope traceEvent("ImageIO::Read", m_ImageIO->GetNameOfClass(), sizeOfActualIORegion);
+
   const IOComponentEnum ioType = ImageIOBase::MapPixelType<typename ConvertPixelTraits::ComponentType>::CType;
   if (m_ImageIO->GetComponentType() != ioType ||
       (m_ImageIO->GetNumberOfComponents() != ConvertPixelTraits::GetNumberOfComponents()))
@@ -0,0 +1,235 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkImageFileTileCache_h
+#define itkImageFileTileCache_h
+
+#include "itkImageFileReader.h"
+
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+namespace itk
+{
+
+/** \class ImageFileTileCache
+ * \brief Gives access to an image file too large for memory, one tile at a time.
+ *
+ * ImageFileTileCache divides the largest possible region of an image file
+ * into a grid of tiles of TileSize pixels. A tile is read from the file the
+ * first time it is accessed, through a streaming ImageFileReader, and is then
+ * kept in a least recently used cache. When the cached tiles take more than
+ * MaximumCacheSize bytes, the least recently used ones are released.
+ *
+ * Each tile is an ordinary ImageType instance, whose buffered region
+ * contains the tile region, so that the usual iterators can traverse it.
+ * ForEachTile() traverses a region tile by tile:
+ *
+ * \code
+ * auto cache = itk::ImageFileTileCache<ImageType>::New();
+ * cache->SetFileName("lightsheet.mha");
+ * cache->SetMaximumCacheSize(SizeValueType{ 1 } << 30);
+ * cache->ReadImageInformation();
+ *
+ * double sum = 0.0;
+ * cache->ForEachTile(cache->GetLargestPossibleRegion(),
+ *                    [&sum](const ImageType * tile, const ImageType::RegionType & region) {
+ *                      for (itk::ImageScanlineConstIterator it(tile, region); !it.IsAtEnd(); it.NextLine())
+ *                      {
+ *                        for (; !it.IsAtEndOfLine(); ++it)
+ *                        {
+ *                          sum += it.Get();
+ *                        }
+ *                      }
+ *                    });
+ * \endcode
+ *
+ * The ImageIO must support streamed reading, as the uncompressed MetaImage
+ * and NRRD formats do. The cache is read-only, and its methods may be
+ * called concurrently: the tiles are read one at a time, and a tile
+ * returned by GetTile() stays valid after it is released from the cache.
+ *
+ * \sa ImageFileReader
+ * \sa StreamingImageFilter
+ *
+ * \ingroup IOFilters
+ * \ingroup ITKIOImageBase
+ */
+template <typename TImage>
+class ITK_TEMPLATE_EXPORT ImageFileTileCache : public Object
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(ImageFileTileCache);
+
+  /** Standard class type aliases. */
+  using Self = ImageFileTileCache;
+  using Superclass = Object;
+  using Pointer = SmartPointer<Self>;
+  using ConstPointer = SmartPointer<const Self>;
+
+  /** Method for creation through the object factory. */
+  itkNewMacro(Self);
+
+  /** \see LightObject::GetNameOfClass() */
+  itkOverrideGetNameOfClassMacro(ImageFileTileCache);
+
+  /** Image related type alias. */
+  using ImageType = TImage;
+  using ImagePointer = typename ImageType::Pointer;
+  using PixelType = typename ImageType::PixelType;
+  using RegionType = typename ImageType::RegionType;
+  using IndexType = typename ImageType::IndexType;
+  using SizeType = typename ImageType::SizeType;
+  using ReaderType = ImageFileReader<ImageType>;
+
+  static constexpr unsigned int ImageDimension = ImageType::ImageDimension;
+
+  /** Set/Get the name of the file to read. */
+  /** @ITKStartGrouping */
+  itkSetStringMacro(FileName);
+  itkGetStringMacro(FileName);
+  /** @ITKEndGrouping */
+  /** Set/Get the ImageIO used to read the file. If it is not set, it is
+   * created by the object factory mechanism. */
+  /** @ITKStartGrouping */
+  itkSetObjectMacro(ImageIO, ImageIOBase);
+  itkGetModifiableObjectMacro(ImageIO, ImageIOBase);
+  /** @ITKEndGrouping */
+  /** Set/Get the size of the tiles, in pixels. Defaults to 64 pixels along
+   * each dimension. */
+  /** @ITKStartGrouping */
+  itkSetMacro(TileSize, SizeType);
+  itkGetConstReferenceMacro(TileSize, SizeType);
+  /** @ITKEndGrouping */
+  /** Set/Get the number of bytes the cached tiles may take. The most
+   * recently used tile is kept even if it is larger. Defaults to 1 GiB. */
+  /** @ITKStartGrouping */
+  itkSetMacro(MaximumCacheSize, SizeValueType);
+  itkGetConstMacro(MaximumCacheSize, SizeValueType);
+  /** @ITKEndGrouping */
+
+  /** Reads the image information from the file, and empties the cache. Must
+   * be called after setting the file name and the tile size, and before
+   * accessing the tiles. Throws an exception when the file cannot be read
+   * by streaming. */
+  void
+  ReadImageInformation();
+
+  /** Returns the largest possible region of the image in the file. */
+  const RegionType &
+  GetLargestPossibleRegion() const
+  {
+    return m_LargestPossibleRegion;
+  }
+
+  /** Returns the index, in the grid of tiles, of the tile that contains the
+   * specified pixel. */
+  IndexType
+  ComputeTileIndex(const IndexType & index) const;
+
+  /** Returns the region of the specified tile, cropped to the largest
+   * possible region. */
+  RegionType
+  GetTileRegion(const IndexType & tileIndex) const;
+
+  /** Returns the specified tile, reading it from the file when it is not
+   * cached. */
+  ImagePointer
+  GetTile(const IndexType & tileIndex);
+
+  /** Returns the value of the specified pixel, reading its tile from the
+   * file when it is not cached. Use ForEachTile() to access many pixels. */
+  PixelType
+  GetPixel(const IndexType & index);
+
+  /** Calls `function(tile, tileRegion)` for each tile intersecting the
+   * specified region, the tiles being visited with the fastest dimension
+   * first. `tile` is a `const ImageType *`, and `tileRegion` the part of the
+   * region inside this tile, so that at most one tile needs to be cached. */
+  template <typename TFunction>
+  void
+  ForEachTile(const RegionType & region, TFunction && function);
+
+  /** Releases all the cached tiles. */
+  void
+  ReleaseTiles();
+
+  /** Returns the number of tiles currently cached. */
+  SizeValueType
+  GetNumberOfCachedTiles() const;
+
+  /** Returns the number of bytes taken by the cached tiles. */
+  SizeValueType
+  GetCacheSize() const;
+
+  /** Returns the number of tiles read from the file since the image
+   * information was read. */
+  SizeValueType
+  GetNumberOfTileReads() const;
+
+protected:
+  ImageFileTileCache();
+  ~ImageFileTileCache() override = default;
+
+  void
+  PrintSelf(std::ostream & os, Indent indent) const override;
+
+private:
+  struct CachedTile
+  {
+    SizeValueType tileNumber;
+    ImagePointer  tile;
+    SizeValueType size;
+  };
+
+  using TileListType = std::list<CachedTile>;
+
+  /** Returns the position of the tile in the grid of tiles, with the fastest
+   * dimension first. */
+  SizeValueType
+  ComputeTileNumber(const IndexType & tileIndex) const;
+
+  /** Releases the least recently used tiles, until the cache fits in
+   * MaximumCacheSize. The mutex must be held by the caller. */
+  void
+  ReleaseLeastRecentlyUsedTiles();
+
+  std::string          m_FileName{};
+  ImageIOBase::Pointer m_ImageIO{};
+  SizeType             m_TileSize{ MakeFilled<SizeType>(64) };
+  SizeValueType        m_MaximumCacheSize{ SizeValueType{ 1 } << 30 };
+
+  typename ReaderType::Pointer m_Reader{};
+  RegionType                   m_LargestPossibleRegion{};
+  SizeType                     m_NumberOfTiles{};
+
+  // The cached tiles, the most recently used first, and their positions in
+  // this list, by tile number.
+  TileListType                                                       m_Tiles{};
+  std::unordered_map<SizeValueType, typename TileListType::iterator> m_TilePositions{};
+  SizeValueType                                                      m_CacheSize{};
+  SizeValueType                                                      m_NumberOfTileReads{};
+  mutable std::mutex                                                 m_Mutex{};
+};
+} // namespace itk
+
+#ifndef ITK_MANUAL_INSTANTIATION
+#  include "itkImageFileTileCache.hxx"
+#endif
+
+#endif // itkImageFileTileCache_h
@@ -0,0 +1,272 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkImageFileTileCache_hxx
+#define itkImageFileTileCache_hxx
+
+#include "itkMath.h"
+
+namespace itk
+{
+
+template <typename TImage>
+ImageFileTileCache<TImage>::ImageFileTileCache() = default;
+
+template <typename TImage>
+void
+ImageFileTileCache<TImage>::ReadImageInformation()
+{
+  const std::lock_guard<std::mutex> lock(m_Mutex);
+
+  for (unsigned int i = 0; i < ImageDimension; ++i)
+  {
+    if (m_TileSize[i] == 0)
+    {
+      itkExceptionMacro("The tile size must not be zero: " << m_TileSize);
+    }
+  }
+
+  m_Tiles.clear();
+  m_TilePositions.clear();
+  m_CacheSize = 0;
+  m_NumberOfTileReads = 0;
+
+  m_Reader = ReaderType::New();
+  m_Reader->SetFileName(m_FileName);
+  if (m_ImageIO)
+  {
+    m_Reader->SetImageIO(m_ImageIO);
+  }
+  m_Reader->UpdateOutputInformation();
+  m_ImageIO = m_Reader->GetModifiableImageIO();
+
+  if (!m_ImageIO->CanStreamRead())
+  {
+    itkExceptionMacro("The " << m_ImageIO->GetNameOfClass() << " of " << m_FileName
+                             << " cannot read a part of the file, so that it cannot be read tile by tile.");
+  }
+
+  m_LargestPossibleRegion = m_Reader->GetOutput()->GetLargestPossibleRegion();
+  for (unsigned int i = 0; i < ImageDimension; ++i)
+  {
+    m_NumberOfTiles[i] = (m_LargestPossibleRegion.GetSize(i) + m_TileSize[i] - 1) / m_TileSize[i];
+  }
+}
+
+template <typename TImage>
+auto
+ImageFileTileCache<TImage>::ComputeTileIndex(const IndexType & index) const -> IndexType
+{
+  IndexType tileIndex;
+  for (unsigned int i = 0; i < ImageDimension; ++i)
+  {
+    tileIndex[i] = Math::Floor<IndexValueType>(static_cast<double>(index[i] - m_LargestPossibleRegion.GetIndex(i)) /
+                                               static_cast<double>(m_TileSize[i]));
+  }
+  return tileIndex;
+}
+
+template <typename TImage>
+auto
+ImageFileTileCache<TImage>::GetTileRegion(const IndexType & tileIndex) const -> RegionType
+{
+  IndexType index;
+  for (unsigned int i = 0; i < ImageDimension; ++i)
+  {
+    index[i] = m_LargestPossibleRegion.GetIndex(i) + tileIndex[i] * static_cast<IndexValueType>(m_TileSize[i]);
+  }
+  RegionType tileRegion(index, m_TileSize);
+  tileRegion.Crop(m_LargestPossibleRegion);
+  return tileRegion;
+}
+
+template <typename TImage>
+SizeValueType
+ImageFileTileCache<TImage>::ComputeTileNumber(const IndexType & tileIndex) const
+{
+  SizeValueType tileNumber = 0;
+  for (unsigned int i = ImageDimension; i > 0; --i)
+  {
+    tileNumber = tileNumber * m_NumberOfTiles[i - 1] + static_cast<SizeValueType>(tileIndex[i - 1]);
+  }
+  return tileNumber;
+}
+
+template <typename TImage>
+auto
+ImageFileTileCache<TImage>::GetTile(const IndexType & tileIndex) -> ImagePointer
+{
+  const std::lock_guard<std::mutex> lock(m_Mutex);
+
+  if (m_Reader.IsNull())
+  {
+    itkExceptionMacro("ReadImageInformation() must be called before accessing the tiles.");
+  }
+  for (unsigned int i = 0; i < ImageDimension; ++i)
+  {
+    if (tileIndex[i] < 0 || static_cast<SizeValueType>(tileIndex[i]) >= m_NumberOfTiles[i])
+    {
+      itkExceptionMacro("Tile " << tileIndex << " is outside the grid of " << m_NumberOfTiles << " tiles.");
+    }
+  }
+
+  const SizeValueType tileNumber = this->ComputeTileNumber(tileIndex);
+
+  if (const auto found = m_TilePositions.find(tileNumber); found != m_TilePositions.end())
+  {
+    // Move the tile to the front of the list, as the most recently used.
+    m_Tiles.splice(m_Tiles.begin(), m_Tiles, found->second);
+    return m_Tiles.front().tile;
+  }
+
+  ImageType * const output = m_Reader->GetOutput();
+  output->SetRequestedRegion(this->GetTileRegion(tileIndex));
+  output->Update();
+
+  // Take the ownership of the tile, so that the reader produces a new image
+  // for the next tile.
+  const ImagePointer tile = output;
+  tile->DisconnectPipeline();
+  ++m_NumberOfTileReads;
+
+  const auto tileSize =
+    static_cast<SizeValueType>(tile->GetPixelContainer()->Size() * sizeof(typename ImageType::InternalPixelType));
+  m_Tiles.push_front(CachedTile{ tileNumber, tile, tileSize });
+  m_TilePositions[tileNumber] = m_Tiles.begin();
+  m_CacheSize += tileSize;
+
+  this->ReleaseLeastRecentlyUsedTiles();
+
+  return tile;
+}
+
+template <typename TImage>
+auto
+ImageFileTileCache<TImage>::GetPixel(const IndexType & index) -> PixelType
+{
+  return this->GetTile(this->ComputeTileIndex(index))->GetPixel(index);
+}
+
+template <typename TImage>
+template <typename TFunction>
+void
+ImageFileTileCache<TImage>::ForEachTile(const RegionType & region, TFunction && function)
+{
+  if (region.GetNumberOfPixels() == 0)
+  {
+    return;
+  }
+
+  const IndexType firstTileIndex = this->ComputeTileIndex(region.GetIndex());
+  const IndexType lastTileIndex = this->ComputeTileIndex(region.GetUpperIndex());
+
+  IndexType tileIndex = firstTileIndex;
+  while (true)
+  {
+    RegionType tileRegion = this->GetTileRegion(tileIndex);
+    if (tileRegion.Crop(region))
+    {
+      const ImagePointer tile = this->GetTile(tileIndex);
+      function(static_cast<const ImageType *>(tile.GetPointer()), static_cast<const RegionType &>(tileRegion));
+    }
+
+    // Go to the next tile, the fastest dimension first.
+    unsigned int i = 0;
+    for (; i < ImageDimension; ++i)
+    {
+      if (tileIndex[i] < lastTileIndex[i])
+      {
+        ++tileIndex[i];
+        break;
+      }
+      tileIndex[i] = firstTileIndex[i];
+    }
+    if (i == ImageDimension)
+    {
+      return;
+    }
+  }
+}
+
+template <typename TImage>
+void
+ImageFileTileCache<TImage>::ReleaseLeastRecentlyUsedTiles()
+{
+  while (m_CacheSize > m_MaximumCacheSize && m_Tiles.size() > 1)
+  {
+    const CachedTile & leastRecentlyUsed = m_Tiles.back();
+    m_CacheSize -= leastRecentlyUsed.size;
+    m_TilePositions.erase(leastRecentlyUsed.tileNumber);
+    m_Tiles.pop_back();
+  }
+}
+
+template <typename TImage>
+void
+ImageFileTileCache<TImage>::ReleaseTiles()
+{
+  const std::lock_guard<std::mutex> lock(m_Mutex);
+
+  m_Tiles.clear();
+  m_TilePositions.clear();
+  m_CacheSize = 0;
+}
+
+template <typename TImage>
+SizeValueType
+ImageFileTileCache<TImage>::GetNumberOfCachedTiles() const
+{
+  const std::lock_guard<std::mutex> lock(m_Mutex);
+  return static_cast<SizeValueType>(m_Tiles.size());
+}
+
+template <typename TImage>
+SizeValueType
+ImageFileTileCache<TImage>::GetCacheSize() const
+{
+  const std::lock_guard<std::mutex> lock(m_Mutex);
+  return m_CacheSize;
+}
+
+template <typename TImage>
+SizeValueType
+ImageFileTileCache<TImage>::GetNumberOfTileReads() const
+{
+  const std::lock_guard<std::mutex> lock(m_Mutex);
+  return m_NumberOfTileReads;
+}
+
+template <typename TImage>
+void
+ImageFileTileCache<TImage>::PrintSelf(std::ostream & os, Indent indent) const
+{
+  Superclass::PrintSelf(os, indent);
+
+  os << indent << "FileName: " << m_FileName << std::endl;
+  itkPrintSelfObjectMacro(ImageIO);
+  os << indent << "TileSize: " << static_cast<typename NumericTraits<SizeType>::PrintType>(m_TileSize) << std::endl;
+  os << indent << "MaximumCacheSize: " << m_MaximumCacheSize << std::endl;
+  os << indent << "LargestPossibleRegion: " << m_LargestPossibleRegion << std::endl;
+  os << indent << "NumberOfTiles: " << static_cast<typename NumericTraits<SizeType>::PrintType>(m_NumberOfTiles)
+     << std::endl;
+  os << indent << "NumberOfCachedTiles: " << this->GetNumberOfCachedTiles() << std::endl;
+  os << indent << "CacheSize: " << this->GetCacheSize() << std::endl;
+  os << indent << "NumberOfTileReads: " << this->GetNumberOfTileReads() << std::endl;
+}
+} // namespace itk
+
+#endif
@@ -31,6 +31,7 @@
 #include "itkDiffusionTensor3D.h"
 #include "itkMatrix.h"
 #include "itkImageAlgorithm.h"
+#include "itkTraceEventRecorder.h"
 #include <complex>
 
 namespace itk
@@ -376,6 +377,10 @@ ImageFileWriter<TInputImage>::GenerateData()
     }
   }
 
+  const TraceEventScope traceEvent("ImageIO::Write",
+                                   m_ImageIO->GetNameOfClass(),
+                                   ioRegion.GetNumberOfPixels() * m_ImageIO->GetNumberOfComponents() *
+                                     m_ImageIO->GetComponentSize());
   m_ImageIO->Write(dataPtr);
 }
 
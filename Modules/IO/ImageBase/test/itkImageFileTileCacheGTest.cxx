@@ -0,0 +1,175 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkImageFileTileCache.h"
+#include "itkImageFileWriter.h"
+#include "itkImage.h"
+#include "itkImageScanlineIterator.h"
+#include "itkIndexRange.h"
+
+#include "itkGTest.h"
+#include "itksys/SystemTools.hxx"
+#include "itkTestDriverIncludeRequiredFactories.h"
+
+#define _STRING(s) #s
+#define TOSTRING(s) _STRING(s)
+
+namespace
+{
+
+struct ITKImageFileTileCacheTest : public ::testing::Test
+{
+  void
+  SetUp() override
+  {
+    RegisterRequiredFactories();
+    itksys::SystemTools::ChangeDirectory(TOSTRING(ITK_TEST_OUTPUT_DIR));
+  }
+  using ImageType = itk::Image<unsigned int, 3>;
+  using RegionType = ImageType::RegionType;
+  using IndexType = ImageType::IndexType;
+  using SizeType = ImageType::SizeType;
+  using CacheType = itk::ImageFileTileCache<ImageType>;
+
+  static unsigned int
+  ExpectedPixel(const IndexType & index)
+  {
+    return static_cast<unsigned int>(index[0] + 100 * index[1] + 10000 * index[2]);
+  }
+
+  // Writes an image whose pixel values identify their index.
+  static void
+  WriteImage(const std::string & fileName)
+  {
+    auto image = ImageType::New();
+    image->SetRegions(RegionType(IndexType{ { 0, 0, 0 } }, SizeType{ { 37, 23, 5 } }));
+    image->Allocate();
+    for (itk::ImageScanlineIterator it(image, image->GetBufferedRegion()); !it.IsAtEnd(); it.NextLine())
+    {
+      for (; !it.IsAtEndOfLine(); ++it)
+      {
+        it.Set(ExpectedPixel(it.GetIndex()));
+      }
+    }
+    itk::WriteImage(image, fileName);
+  }
+};
+
+} // namespace
+
+
+TEST_F(ITKImageFileTileCacheTest, ReadsPixelsThroughTiles)
+{
+  const std::string fileName = "ImageFileTileCacheTest.mha";
+  WriteImage(fileName);
+
+  auto cache = CacheType::New();
+  cache->SetFileName(fileName);
+  cache->SetTileSize(SizeType{ { 16, 8, 2 } });
+  cache->ReadImageInformation();
+  ITK_GTEST_EXERCISE_BASIC_OBJECT_METHODS(cache, ImageFileTileCache, Object);
+
+  EXPECT_EQ(cache->GetLargestPossibleRegion().GetSize(), (SizeType{ { 37, 23, 5 } }));
+  EXPECT_EQ(cache->ComputeTileIndex(IndexType{ { 36, 8, 4 } }), (IndexType{ { 2, 1, 2 } }));
+  EXPECT_EQ(cache->GetTileRegion(IndexType{ { 2, 2, 2 } }),
+            RegionType(IndexType{ { 32, 16, 4 } }, SizeType{ { 5, 7, 1 } }));
+
+  // Each tile is only read once, however many of its pixels are accessed.
+  for (const auto & index : itk::ImageRegionIndexRange<3>(cache->GetLargestPossibleRegion()))
+  {
+    ASSERT_EQ(cache->GetPixel(index), ExpectedPixel(index));
+  }
+  EXPECT_EQ(cache->GetNumberOfTileReads(), 3u * 3u * 3u);
+  EXPECT_EQ(cache->GetNumberOfCachedTiles(), 3u * 3u * 3u);
+
+  const auto tile = cache->GetTile(IndexType{ { 1, 0, 1 } });
+  EXPECT_TRUE(tile->GetBufferedRegion().IsInside(cache->GetTileRegion(IndexType{ { 1, 0, 1 } })));
+  EXPECT_EQ(cache->GetNumberOfTileReads(), 3u * 3u * 3u);
+
+  cache->ReleaseTiles();
+  EXPECT_EQ(cache->GetNumberOfCachedTiles(), 0u);
+  EXPECT_EQ(cache->GetCacheSize(), 0u);
+}
+
+
+TEST_F(ITKImageFileTileCacheTest, ReleasesLeastRecentlyUsedTiles)
+{
+  const std::string fileName = "ImageFileTileCacheTest2.mha";
+  WriteImage(fileName);
+
+  auto cache = CacheType::New();
+  cache->SetFileName(fileName);
+  cache->SetTileSize(SizeType{ { 8, 8, 1 } });
+  // Room for two tiles of 8x8 pixels.
+  cache->SetMaximumCacheSize(2 * 8 * 8 * sizeof(unsigned int));
+  cache->ReadImageInformation();
+
+  cache->GetTile(IndexType{ { 0, 0, 0 } });
+  cache->GetTile(IndexType{ { 1, 0, 0 } });
+  cache->GetTile(IndexType{ { 0, 0, 0 } });
+  EXPECT_EQ(cache->GetNumberOfTileReads(), 2u);
+
+  // Tile (1, 0, 0) is the least recently used, so that it is released.
+  cache->GetTile(IndexType{ { 2, 0, 0 } });
+  EXPECT_EQ(cache->GetNumberOfCachedTiles(), 2u);
+  cache->GetTile(IndexType{ { 0, 0, 0 } });
+  EXPECT_EQ(cache->GetNumberOfTileReads(), 3u);
+  cache->GetTile(IndexType{ { 1, 0, 0 } });
+  EXPECT_EQ(cache->GetNumberOfTileReads(), 4u);
+  EXPECT_LE(cache->GetCacheSize(), cache->GetMaximumCacheSize());
+}
+
+
+TEST_F(ITKImageFileTileCacheTest, ForEachTileVisitsRegionOnce)
+{
+  const std::string fileName = "ImageFileTileCacheTest3.mha";
+  WriteImage(fileName);
+
+  auto cache = CacheType::New();
+  cache->SetFileName(fileName);
+  cache->SetTileSize(SizeType{ { 10, 10, 2 } });
+  cache->SetMaximumCacheSize(0);
+  cache->ReadImageInformation();
+
+  const RegionType region(IndexType{ { 3, 5, 1 } }, SizeType{ { 30, 12, 3 } });
+
+  auto visits = ImageType::New();
+  visits->SetRegions(cache->GetLargestPossibleRegion());
+  visits->AllocateInitialized();
+
+  cache->ForEachTile(region, [&visits](const ImageType * tile, const RegionType & tileRegion) {
+    EXPECT_TRUE(tile->GetBufferedRegion().IsInside(tileRegion));
+    for (itk::ImageScanlineConstIterator it(tile, tileRegion); !it.IsAtEnd(); it.NextLine())
+    {
+      for (; !it.IsAtEndOfLine(); ++it)
+      {
+        EXPECT_EQ(it.Get(), ExpectedPixel(it.GetIndex()));
+        visits->SetPixel(it.GetIndex(), visits->GetPixel(it.GetIndex()) + 1);
+      }
+    }
+  });
+
+  for (const auto & index : itk::ImageRegionIndexRange<3>(cache->GetLargestPossibleRegion()))
+  {
+    EXPECT_EQ(visits->GetPixel(index), region.IsInside(index) ? 1u : 0u);
+  }
+
+  // Only the last tile is kept, as the cache has no room for more.
+  EXPECT_EQ(cache->GetNumberOfCachedTiles(), 1u);
+  EXPECT_EQ(cache->GetNumberOfTileReads(), 4u * 2u * 2u);
+}
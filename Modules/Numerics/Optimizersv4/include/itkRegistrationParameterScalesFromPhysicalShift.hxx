@@ -53,32 +53,38 @@ RegistrationParameterScalesFromPhysicalShift<TMetric>::ComputeSampleShiftsIntern
 
   const auto numSamples = static_cast<const SizeValueType>(this->m_SamplePoints.size());
 
-  VirtualPointType    point;
-  TransformOutputType newMappedVoxel;
-
   // store the old mapped indices to reduce calls to Transform::SetParameters()
   std::vector<TransformOutputType> oldMappedVoxels(numSamples);
   sampleShifts.SetSize(numSamples);
 
+  // Mapping a point does not modify the transform, so the sample points are
+  // distributed over the work units.
+  MultiThreaderBase * multiThreader = this->GetMultiThreader();
+
   // compute the indices mapped by the old transform
-  for (SizeValueType c = 0; c < numSamples; ++c)
-  {
-    point = this->m_SamplePoints[c];
-    this->template TransformPoint<TransformOutputType>(point, oldMappedVoxels[c]);
-  }
+  multiThreader->ParallelizeArray(
+    0,
+    numSamples,
+    [this, &oldMappedVoxels](SizeValueType c) {
+      this->template TransformPoint<TransformOutputType>(this->m_SamplePoints[c], oldMappedVoxels[c]);
+    },
+    nullptr);
 
   // Apply the delta parameters to the transform
   this->UpdateTransformParameters(deltaParameters);
 
   // compute the indices mapped by the new transform
-  for (SizeValueType c = 0; c < numSamples; ++c)
-  {
-    point = this->m_SamplePoints[c];
-    this->template TransformPoint<TransformOutputType>(point, newMappedVoxel);
-
-    // find the local shift for each sample point
-    sampleShifts[c] = newMappedVoxel.EuclideanDistanceTo(oldMappedVoxels[c]);
-  }
+  multiThreader->ParallelizeArray(
+    0,
+    numSamples,
+    [this, &oldMappedVoxels, &sampleShifts](SizeValueType c) {
+      TransformOutputType newMappedVoxel;
+      this->template TransformPoint<TransformOutputType>(this->m_SamplePoints[c], newMappedVoxel);
+
+      // find the local shift for each sample point
+      sampleShifts[c] = newMappedVoxel.EuclideanDistanceTo(oldMappedVoxels[c]);
+    },
+    nullptr);
 
   // restore the parameters in the transform
   transform->SetParameters(oldParameters);
@@ -19,6 +19,7 @@
 #define itkRegistrationParameterScalesFromShiftBase_h
 
 #include "itkRegistrationParameterScalesEstimator.h"
+#include "itkMultiThreaderBase.h"
 
 namespace itk
 {
@@ -37,6 +38,11 @@ namespace itk
  * differently depending on the type of metric transform or metric type.
  * See RegistrationParameterScalesEstimator documentation.
  *
+ * The sample points are mapped in parallel with the multi-threader returned
+ * by GetMultiThreader(). For b-spline transforms, only the parameters whose
+ * support overlaps at least one sample point are perturbed; all other
+ * parameters cannot shift a sample point.
+ *
  * \sa RegistrationParameterScalesEstimator
  * \ingroup ITKOptimizersv4
  */
@@ -90,6 +96,10 @@ public:
   itkSetMacro(SmallParameterVariation, ParametersValueType);
   itkGetConstMacro(SmallParameterVariation, ParametersValueType);
   /** @ITKEndGrouping */
+
+  /** Get the multi-threader used to map the sample points. */
+  itkGetModifiableObjectMacro(MultiThreader, MultiThreaderBase);
+
 protected:
   RegistrationParameterScalesFromShiftBase();
   ~RegistrationParameterScalesFromShiftBase() override = default;
@@ -107,10 +117,18 @@ protected:
   virtual void
   ComputeSampleShifts(const ParametersType & deltaParameters, ScalesType & localShifts) = 0;
 
+  /** Collect the local parameters that have a non-zero Jacobian at one or
+   * more sample points. Perturbing any other parameter of a transform with
+   * local support leaves all sample points in place. */
+  void
+  ComputeParametersWithSampleSupport(std::vector<SizeValueType> & supportedParameters);
+
 private:
   // A small variation of parameters
   ParametersValueType m_SmallParameterVariation{};
 
+  MultiThreaderBase::Pointer m_MultiThreader{};
+
 }; // class RegistrationParameterScalesFromShiftBase
 
 
@@ -19,6 +19,7 @@
 #define itkRegistrationParameterScalesFromShiftBase_hxx
 
 #include <algorithm> // For max.
+#include <numeric>   // For iota.
 
 namespace itk
 {
@@ -26,6 +27,7 @@ namespace itk
 template <typename TMetric>
 RegistrationParameterScalesFromShiftBase<TMetric>::RegistrationParameterScalesFromShiftBase()
   : m_SmallParameterVariation(0.01)
+  , m_MultiThreader(MultiThreaderBase::New())
 {}
 
 /** Compute parameter scales */
@@ -68,8 +70,22 @@ RegistrationParameterScalesFromShiftBase<TMetric>::EstimateScales(ScalesType & p
     }
   }
 
+  // Only the parameters of a b-spline transform whose support covers a sample
+  // point can produce a shift; the scales of all others stay at zero.
+  std::vector<SizeValueType> parametersToPerturb;
+  if (this->IsBSplineTransform())
+  {
+    this->ComputeParametersWithSampleSupport(parametersToPerturb);
+  }
+  else
+  {
+    parametersToPerturb.resize(numLocalPara);
+    std::iota(parametersToPerturb.begin(), parametersToPerturb.end(), SizeValueType{ 0 });
+  }
+  parameterScales.Fill(typename ScalesType::ValueType{});
+
   // compute voxel shift generated from each transform parameter
-  for (SizeValueType i = 0; i < numLocalPara; ++i)
+  for (const SizeValueType i : parametersToPerturb)
   {
     // For local support, we need to refill deltaParameters with zeros at each loop
     // since smoothing may change the values around the local voxel.
@@ -191,6 +207,38 @@ RegistrationParameterScalesFromShiftBase<TMetric>::EstimateLocalStepScales(const
   }
 }
 
+template <typename TMetric>
+void
+RegistrationParameterScalesFromShiftBase<TMetric>::ComputeParametersWithSampleSupport(
+  std::vector<SizeValueType> & supportedParameters)
+{
+  const SizeValueType numLocalPara = this->GetNumberOfLocalParameters();
+
+  std::vector<bool> isSupported(numLocalPara, false);
+  ParametersType    squareNorms(numLocalPara);
+
+  for (const VirtualPointType & point : this->m_SamplePoints)
+  {
+    this->ComputeSquaredJacobianNorms(point, squareNorms);
+    for (SizeValueType p = 0; p < numLocalPara; ++p)
+    {
+      if (squareNorms[p] > typename ParametersType::ValueType{})
+      {
+        isSupported[p] = true;
+      }
+    }
+  }
+
+  supportedParameters.clear();
+  for (SizeValueType p = 0; p < numLocalPara; ++p)
+  {
+    if (isSupported[p])
+    {
+      supportedParameters.push_back(p);
+    }
+  }
+}
+
 /**
  * Compute the maximum shift when a transform is changed with deltaParameters
  */
@@ -218,6 +266,9 @@ void
 RegistrationParameterScalesFromShiftBase<TMetric>::PrintSelf(std::ostream & os, Indent indent) const
 {
   Superclass::PrintSelf(os, indent);
+
+  os << indent << "SmallParameterVariation: " << m_SmallParameterVariation << std::endl;
+  itkPrintSelfObjectMacro(MultiThreader);
 }
 
 } // namespace itk
@@ -19,7 +19,9 @@
 #include "itkImageToImageMetricv4.h"
 
 #include "itkAffineTransform.h"
+#include "itkBSplineTransform.h"
 #include "itkDisplacementFieldTransform.h"
+#include "itkImageRegionConstIteratorWithIndex.h"
 #include "itkMath.h"
 
 /**
@@ -373,12 +375,93 @@ itkRegistrationParameterScalesFromPhysicalShiftTest(int, char *[])
     std::cout << "Passed: the step scale for the displacement field transform is correct." << std::endl;
   }
 
+  //
+  // Testing scales for a b-spline transform, where only the parameters whose
+  // support covers the central sampling region can shift a sample point
+  //
+  using BSplineTransformType = itk::BSplineTransform<double, ImageDimension, 3>;
+  auto bsplineTransform = BSplineTransformType::New();
+
+  BSplineTransformType::PhysicalDimensionsType bsplinePhysicalDimensions;
+  for (unsigned int d = 0; d < ImageDimension; ++d)
+  {
+    bsplinePhysicalDimensions[d] = upperPoint[d] - virtualImage->GetOrigin()[d];
+  }
+  bsplineTransform->SetTransformDomainOrigin(virtualImage->GetOrigin());
+  bsplineTransform->SetTransformDomainDirection(virtualImage->GetDirection());
+  bsplineTransform->SetTransformDomainPhysicalDimensions(bsplinePhysicalDimensions);
+  bsplineTransform->SetTransformDomainMeshSize(BSplineTransformType::MeshSizeType::Filled(4));
+  bsplineTransform->SetIdentity();
+
+  metric->SetMovingTransform(bsplineTransform);
+  RegistrationParameterScalesFromPhysicalShiftType::ScalesType bsplineScales;
+  shiftScaleEstimator->EstimateScales(bsplineScales);
+  std::cout << "Shift scales for the b-spline transform = " << bsplineScales << std::endl;
+
+  // Compute the expected scale by perturbing every parameter, including the
+  // ones outside the support of the sample points, over the central region
+  // sampled by the estimator.
+  const VirtualImageType::RegionType virtualRegion = virtualImage->GetLargestPossibleRegion();
+  VirtualImageType::IndexType        centralLowerIndex = virtualRegion.GetIndex();
+  VirtualImageType::IndexType        centralUpperIndex = virtualRegion.GetUpperIndex();
+  for (unsigned int d = 0; d < ImageDimension; ++d)
+  {
+    const auto centralIndex = static_cast<itk::IndexValueType>((centralLowerIndex[d] + centralUpperIndex[d]) / 2.0);
+    centralLowerIndex[d] = std::max(centralLowerIndex[d], centralIndex - shiftScaleEstimator->GetCentralRegionRadius());
+    centralUpperIndex[d] = std::min(centralUpperIndex[d], centralIndex + shiftScaleEstimator->GetCentralRegionRadius());
+  }
+  VirtualImageType::RegionType centralRegion;
+  centralRegion.SetIndex(centralLowerIndex);
+  centralRegion.SetUpperIndex(centralUpperIndex);
+
+  itk::ImageRegionConstIteratorWithIndex<VirtualImageType> centralIt(virtualImage, centralRegion);
+
+  FloatType                            theoreticalBSplineScale = itk::NumericTraits<FloatType>::max();
+  BSplineTransformType::ParametersType bsplineParameters(bsplineTransform->GetNumberOfParameters());
+  for (itk::SizeValueType p = 0; p < bsplineTransform->GetNumberOfParameters(); ++p)
+  {
+    bsplineParameters.Fill(0.0);
+    bsplineParameters[p] = shiftScaleEstimator->GetSmallParameterVariation();
+    bsplineTransform->SetParameters(bsplineParameters);
+
+    FloatType maxShift = 0.0;
+    for (centralIt.GoToBegin(); !centralIt.IsAtEnd(); ++centralIt)
+    {
+      VirtualImageType::PointType point;
+      virtualImage->TransformIndexToPhysicalPoint(centralIt.GetIndex(), point);
+      maxShift = std::max(maxShift, bsplineTransform->TransformPoint(point).EuclideanDistanceTo(point));
+    }
+    if (maxShift > itk::NumericTraits<FloatType>::epsilon())
+    {
+      theoreticalBSplineScale = std::min(theoreticalBSplineScale, maxShift);
+    }
+  }
+  bsplineTransform->SetIdentity();
+  std::cout << "Expected shift scale for the b-spline transform = " << theoreticalBSplineScale << std::endl;
+
+  bool bsplinePass = bsplineScales.GetSize() == bsplineTransform->GetNumberOfParameters();
+  for (itk::SizeValueType p = 0; bsplinePass && p < bsplineScales.GetSize(); ++p)
+  {
+    if (itk::Math::Absolute((bsplineScales[p] - theoreticalBSplineScale) / theoreticalBSplineScale) > 1e-6)
+    {
+      bsplinePass = false;
+    }
+  }
+  if (!bsplinePass)
+  {
+    std::cout << "Failed: the shift scales for the b-spline transform are not correct." << std::endl;
+  }
+  else
+  {
+    std::cout << "Passed: the shift scales for the b-spline transform are correct." << std::endl;
+  }
+
   //
   // Check the correctness of all cases above
   //
   std::cout << std::endl;
   if (affinePass && nonUniformForAffine && stepScalePass && displacementPass && localStepScalePass && translationPass &&
-      uniformForTranslation)
+      uniformForTranslation && bsplinePass)
   {
     std::cout << "Test passed" << std::endl;
     return EXIT_SUCCESS;
@@ -21,6 +21,7 @@
 #include "itkImageRegionConstIterator.h"
 #include "itkConstNeighborhoodIterator.h"
 #include <limits>
+#include <vector>
 #include "itkMultiThreaderBase.h"
 #include "itkMakeUniqueForOverwrite.h"
 
@@ -282,20 +283,64 @@ BlockMatchingImageFilter<TFixedImage, TMovingImage, TFeatures, TDisplacements, T
     count += this->m_PointsCount % workUnitCount;
   }
 
-  // start constructing window region and center region (single voxel)
-  ImageRegionType window;
+  // The candidate blocks of a feature point all lie within its search window
+  // extended by the block radius. That patch of the fixed image is copied
+  // once per feature point into a contiguous buffer, as is the moving block,
+  // so that each candidate is read through precomputed offsets instead of a
+  // neighborhood iterator with boundary checks. The values, and the order in
+  // which they are accumulated, are the same as when iterating directly.
   ImageRegionType center;
-  auto            windowSize = ImageSizeType::Filled(1);
-  center.SetSize(windowSize); // size of center region is 1
-  windowSize += m_SearchRadius + m_SearchRadius;
-  window.SetSize(windowSize); // size of window region is 1+2*m_BlockHalfWindow
+  center.SetSize(ImageSizeType::Filled(1)); // size of center region is 1
 
-  // start constructing block iterator
+  ImageSizeType patchRadius;
+  ImageSizeType windowSize;
+  ImageSizeType patchSize;
+  for (unsigned int i = 0; i < ImageSizeType::Dimension; ++i)
+  {
+    patchRadius[i] = m_SearchRadius[i] + m_BlockRadius[i];
+    windowSize[i] = m_SearchRadius[i] + 1 + m_SearchRadius[i];
+    patchSize[i] = patchRadius[i] + 1 + patchRadius[i];
+  }
+
+  // strides of the patch buffer, which is ordered like a neighborhood
+  OffsetValueType patchStrides[ImageSizeType::Dimension];
+  SizeValueType   numberOfVoxelsInPatch = 1;
+  for (unsigned int i = 0; i < ImageSizeType::Dimension; ++i)
+  {
+    patchStrides[i] = numberOfVoxelsInPatch;
+    numberOfVoxelsInPatch *= patchSize[i];
+  }
+
+  // offsets of the block voxels relative to the first voxel of a candidate block
   SizeValueType numberOfVoxelInBlock = 1;
   for (unsigned int i = 0; i < ImageSizeType::Dimension; ++i)
   {
     numberOfVoxelInBlock *= m_BlockRadius[i] + 1 + m_BlockRadius[i];
   }
+  std::vector<OffsetValueType> blockOffsets(numberOfVoxelInBlock);
+  {
+    Offset<ImageDimension> blockPosition{};
+    for (SizeValueType i = 0; i < numberOfVoxelInBlock; ++i)
+    {
+      OffsetValueType offset = 0;
+      for (unsigned int d = 0; d < ImageSizeType::Dimension; ++d)
+      {
+        offset += blockPosition[d] * patchStrides[d];
+      }
+      blockOffsets[i] = offset;
+      for (unsigned int d = 0; d < ImageSizeType::Dimension; ++d)
+      {
+        if (++blockPosition[d] <= static_cast<IndexValueType>(2 * m_BlockRadius[d]))
+        {
+          break;
+        }
+        blockPosition[d] = 0;
+      }
+    }
+  }
+
+  std::vector<SimilaritiesValue> fixedPatch(numberOfVoxelsInPatch);
+  std::vector<SimilaritiesValue> movingBlock(numberOfVoxelInBlock);
 
   // loop thru feature points
   for (SizeValueType idx = first, last = first + count; idx < last; ++idx)
@@ -310,42 +355,59 @@ BlockMatchingImageFilter<TFixedImage, TMovingImage, TFeatures, TDisplacements, T
     // New point location
     DisplacementsVector displacement;
 
-    // set centers of window and center regions to current location
-    const ImageIndexType start = fixedIndex - this->m_SearchRadius;
-    window.SetIndex(start);
+    // copy the voxels in the neighborhood of the current feature point from the moving image
     center.SetIndex(movingIndex);
-
-    // iterate over neighborhoods in region window, for each neighborhood: iterate over voxels in blockRadius
-    ConstNeighborhoodIterator<FixedImageType> windowIterator(m_BlockRadius, fixedImage, window);
-
-    // iterate over voxels in neighborhood of current feature point
     ConstNeighborhoodIterator<MovingImageType> centerIterator(m_BlockRadius, movingImage, center);
     centerIterator.GoToBegin();
 
-    // iterate over neighborhoods in region window
-    for (windowIterator.GoToBegin(); !windowIterator.IsAtEnd(); ++windowIterator)
+    SimilaritiesValue movingSum{};
+    SimilaritiesValue movingSumOfSquares{};
+    for (SizeValueType i = 0; i < numberOfVoxelInBlock; ++i)
     {
+      const SimilaritiesValue movingValue = centerIterator.GetPixel(i);
+      movingBlock[i] = movingValue;
+      movingSum += movingValue;
+      movingSumOfSquares += movingValue * movingValue;
+    }
+    const SimilaritiesValue movingMean = movingSum / numberOfVoxelInBlock;
+    const SimilaritiesValue movingVariance = movingSumOfSquares - numberOfVoxelInBlock * movingMean * movingMean;
+
+    // copy the search window, extended by the block radius, from the fixed image
+    center.SetIndex(fixedIndex);
+    ConstNeighborhoodIterator<FixedImageType> patchIterator(patchRadius, fixedImage, center);
+    patchIterator.GoToBegin();
+    for (SizeValueType i = 0; i < numberOfVoxelsInPatch; ++i)
+    {
+      fixedPatch[i] = patchIterator.GetPixel(i);
+    }
+
+    // iterate over the candidate blocks in the search window
+    const ImageIndexType   start = fixedIndex - this->m_SearchRadius;
+    Offset<ImageDimension> windowPosition{};
+    bool                   candidatesLeft = true;
+    while (candidatesLeft)
+    {
+      OffsetValueType candidateOffset = 0;
+      for (unsigned int d = 0; d < ImageSizeType::Dimension; ++d)
+      {
+        candidateOffset += windowPosition[d] * patchStrides[d];
+      }
+      const SimilaritiesValue * candidate = fixedPatch.data() + candidateOffset;
+
       SimilaritiesValue fixedSum{};
       SimilaritiesValue fixedSumOfSquares{};
-      SimilaritiesValue movingSum{};
-      SimilaritiesValue movingSumOfSquares{};
       SimilaritiesValue covariance{};
 
       // iterate over voxels in blockRadius
-      for (SizeValueType i = 0; i < numberOfVoxelInBlock; ++i) // windowIterator.Size() == numberOfVoxelInBlock
+      for (SizeValueType i = 0; i < numberOfVoxelInBlock; ++i)
       {
-        const SimilaritiesValue fixedValue = windowIterator.GetPixel(i);
-        const SimilaritiesValue movingValue = centerIterator.GetPixel(i);
-        movingSum += movingValue;
+        const SimilaritiesValue fixedValue = candidate[blockOffsets[i]];
         fixedSum += fixedValue;
-        movingSumOfSquares += movingValue * movingValue;
         fixedSumOfSquares += fixedValue * fixedValue;
-        covariance += fixedValue * movingValue;
+        covariance += fixedValue * movingBlock[i];
       }
       const SimilaritiesValue fixedMean = fixedSum / numberOfVoxelInBlock;
-      const SimilaritiesValue movingMean = movingSum / numberOfVoxelInBlock;
       const SimilaritiesValue fixedVariance = fixedSumOfSquares - numberOfVoxelInBlock * fixedMean * fixedMean;
-      const SimilaritiesValue movingVariance = movingSumOfSquares - numberOfVoxelInBlock * movingMean * movingMean;
       covariance -= numberOfVoxelInBlock * fixedMean * movingMean;
 
       SimilaritiesValue sim{};
@@ -357,10 +419,22 @@ BlockMatchingImageFilter<TFixedImage, TMovingImage, TFeatures, TDisplacements, T
       if (sim >= similarity)
       {
         FeaturePointsPhysicalCoordinates newLocation;
-        fixedImage->TransformIndexToPhysicalPoint(windowIterator.GetIndex(), newLocation);
+        fixedImage->TransformIndexToPhysicalPoint(start + windowPosition, newLocation);
         displacement = newLocation - originalLocation;
         similarity = sim;
       }
+
+      // advance to the next candidate in the same order as an image region iterator
+      candidatesLeft = false;
+      for (unsigned int d = 0; d < ImageSizeType::Dimension; ++d)
+      {
+        if (++windowPosition[d] < static_cast<IndexValueType>(windowSize[d]))
+        {
+          candidatesLeft = true;
+          break;
+        }
+        windowPosition[d] = 0;
+      }
     }
     this->m_DisplacementsVectorsArray[idx] = displacement;
     this->m_SimilaritiesValuesArray[idx] = similarity;
@@ -84,6 +84,7 @@ public:
   using typename Superclass::MovingImagePixelType;
   using typename Superclass::MovingImageGradientType;
   using typename Superclass::MeasureType;
+  using typename Superclass::CompensatedMeasureType;
   using typename Superclass::DerivativeType;
   using typename Superclass::DerivativeValueType;
 
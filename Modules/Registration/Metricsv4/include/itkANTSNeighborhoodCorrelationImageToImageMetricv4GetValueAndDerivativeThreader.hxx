@@ -41,13 +41,13 @@ ANTSNeighborhoodCorrelationImageToImageMetricv4GetValueAndDerivativeThreader<TDo
 
   std::call_once(this->m_ANTSAssociateOnceFlag, [this, &associate]() { this->m_ANTSAssociate = associate; });
 
-  VirtualPointType   virtualPoint;
-  MeasureType        metricValueResult{};
-  MeasureType        metricValueSum{};
-  bool               pointIsValid = false;
-  ScanIteratorType   scanIt;
-  ScanParametersType scanParameters;
-  ScanMemType        scanMem;
+  VirtualPointType       virtualPoint;
+  MeasureType            metricValueResult{};
+  CompensatedMeasureType metricValueSum;
+  bool                   pointIsValid = false;
+  ScanIteratorType       scanIt;
+  ScanParametersType     scanParameters;
+  ScanMemType            scanMem;
 
   DerivativeType & localDerivativeResult = this->m_GetValueAndDerivativePerThreadVariables[threadId].LocalDerivatives;
 
@@ -128,17 +128,19 @@ private:
    * intensity, computed using the helper
    * class CorrelationHelperImageToImageMetricv4GetValueAndDerivativeThreader.
    * say f_i is the i-th pixel of fixed image, m_i is the i-th pixel of moving
-   * image: see the comments below
+   * image: see the comments below. The scalar sums are compensated, so that
+   * they stay accurate with a single precision InternalComputationValueType.
    */
+  using CompensatedSummationType = CompensatedSummation<InternalComputationValueType>;
   struct CorrelationMetricValueDerivativePerThreadStruct
-  {                                   // keep cumulative summation over points for:
-    InternalComputationValueType fm;  // (f_i - \bar f) * (m_i - \bar m)
-    InternalComputationValueType m2;  // (m_i - \bar m)^2
-    InternalComputationValueType f2;  // (f_i - \bar m)^2
-    InternalComputationValueType m;   // m_i
-    InternalComputationValueType f;   // f_i
-    DerivativeType               fdm; // (f_i - \bar f) * dm_i/dp
-    DerivativeType               mdm; // (m_i - \bar m) * dm_i/dp
+  {                               // keep cumulative summation over points for:
+    CompensatedSummationType fm;  // (f_i - \bar f) * (m_i - \bar m)
+    CompensatedSummationType m2;  // (m_i - \bar m)^2
+    CompensatedSummationType f2;  // (f_i - \bar m)^2
+    CompensatedSummationType m;   // m_i
+    CompensatedSummationType f;   // f_i
+    DerivativeType           fdm; // (f_i - \bar f) * dm_i/dp
+    DerivativeType           mdm; // (m_i - \bar m) * dm_i/dp
   };
 
   itkPadStruct(ITK_CACHE_LINE_ALIGNMENT,
@@ -66,11 +66,11 @@ CorrelationImageToImageMetricv4GetValueAndDerivativeThreader<TDomainPartitioner,
   // Set initial values.
   for (ThreadIdType i = 0; i < numWorkUnitsUsed; ++i)
   {
-    m_CorrelationMetricValueDerivativePerThreadVariables[i].fm = InternalComputationValueType{};
-    m_CorrelationMetricValueDerivativePerThreadVariables[i].f2 = InternalComputationValueType{};
-    m_CorrelationMetricValueDerivativePerThreadVariables[i].m2 = InternalComputationValueType{};
-    m_CorrelationMetricValueDerivativePerThreadVariables[i].f = InternalComputationValueType{};
-    m_CorrelationMetricValueDerivativePerThreadVariables[i].m = InternalComputationValueType{};
+    m_CorrelationMetricValueDerivativePerThreadVariables[i].fm.ResetToZero();
+    m_CorrelationMetricValueDerivativePerThreadVariables[i].f2.ResetToZero();
+    m_CorrelationMetricValueDerivativePerThreadVariables[i].m2.ResetToZero();
+    m_CorrelationMetricValueDerivativePerThreadVariables[i].f.ResetToZero();
+    m_CorrelationMetricValueDerivativePerThreadVariables[i].m.ResetToZero();
 
     this->m_CorrelationMetricValueDerivativePerThreadVariables[i].mdm.Fill(DerivativeValueType{});
     this->m_CorrelationMetricValueDerivativePerThreadVariables[i].fdm.Fill(DerivativeValueType{});
@@ -110,15 +110,18 @@ CorrelationImageToImageMetricv4GetValueAndDerivativeThreader<TDomainPartitioner,
 
   /* Accumulate the metric value from threads and store */
   this->m_CorrelationAssociate->m_Value = InternalComputationValueType{};
-  InternalComputationValueType fm{};
-  InternalComputationValueType f2{};
-  InternalComputationValueType m2{};
+  CompensatedSummationType fmSum;
+  CompensatedSummationType f2Sum;
+  CompensatedSummationType m2Sum;
   for (ThreadIdType threadId = 0; threadId < numWorkUnitsUsed; ++threadId)
   {
-    fm += this->m_CorrelationMetricValueDerivativePerThreadVariables[threadId].fm;
-    m2 += this->m_CorrelationMetricValueDerivativePerThreadVariables[threadId].m2;
-    f2 += this->m_CorrelationMetricValueDerivativePerThreadVariables[threadId].f2;
+    fmSum += this->m_CorrelationMetricValueDerivativePerThreadVariables[threadId].fm;
+    m2Sum += this->m_CorrelationMetricValueDerivativePerThreadVariables[threadId].m2;
+    f2Sum += this->m_CorrelationMetricValueDerivativePerThreadVariables[threadId].f2;
   }
+  const InternalComputationValueType fm = fmSum.GetSum();
+  const InternalComputationValueType f2 = f2Sum.GetSum();
+  const InternalComputationValueType m2 = m2Sum.GetSum();
 
   const InternalComputationValueType m2f2 = m2 * f2;
   if (m2f2 <= NumericTraits<InternalComputationValueType>::epsilon())
@@ -124,10 +124,13 @@ protected:
   }
 
 private:
+  /* The sums are compensated, so that the averages stay accurate with a
+   * single precision InternalComputationValueType. */
+  using CompensatedSummationType = CompensatedSummation<InternalComputationValueType>;
   struct CorrelationMetricPerThreadStruct
   {
-    InternalComputationValueType FixSum;
-    InternalComputationValueType MovSum;
+    CompensatedSummationType FixSum;
+    CompensatedSummationType MovSum;
   };
   itkPadStruct(ITK_CACHE_LINE_ALIGNMENT, CorrelationMetricPerThreadStruct, PaddedCorrelationMetricPerThreadStruct);
   itkAlignedTypedef(ITK_CACHE_LINE_ALIGNMENT,
@@ -49,8 +49,8 @@ CorrelationImageToImageMetricv4HelperThreader<TDomainPartitioner, TImageToImageM
   // Set initial values.
   for (ThreadIdType i = 0; i < numWorkUnitsUsed; ++i)
   {
-    this->m_CorrelationMetricPerThreadVariables[i].FixSum = InternalComputationValueType{};
-    this->m_CorrelationMetricPerThreadVariables[i].MovSum = InternalComputationValueType{};
+    this->m_CorrelationMetricPerThreadVariables[i].FixSum.ResetToZero();
+    this->m_CorrelationMetricPerThreadVariables[i].MovSum.ResetToZero();
   }
 }
 
@@ -78,8 +78,8 @@ CorrelationImageToImageMetricv4HelperThreader<TDomainPartitioner, TImageToImageM
     return;
   }
 
-  InternalComputationValueType sumF{};
-  InternalComputationValueType sumM{};
+  CompensatedSummationType sumF;
+  CompensatedSummationType sumM;
 
   for (ThreadIdType threadId = 0; threadId < numWorkUnitsUsed; ++threadId)
   {
@@ -87,8 +87,8 @@ CorrelationImageToImageMetricv4HelperThreader<TDomainPartitioner, TImageToImageM
     sumM += this->m_CorrelationMetricPerThreadVariables[threadId].MovSum;
   }
 
-  this->m_CorrelationAssociate->m_AverageFix = sumF / this->m_CorrelationAssociate->m_NumberOfValidPoints;
-  this->m_CorrelationAssociate->m_AverageMov = sumM / this->m_CorrelationAssociate->m_NumberOfValidPoints;
+  this->m_CorrelationAssociate->m_AverageFix = sumF.GetSum() / this->m_CorrelationAssociate->m_NumberOfValidPoints;
+  this->m_CorrelationAssociate->m_AverageMov = sumM.GetSum() / this->m_CorrelationAssociate->m_NumberOfValidPoints;
 }
 
 template <typename TDomainPartitioner, typename TImageToImageMetric, typename TCorrelationMetric>
@@ -88,6 +88,7 @@ public:
   using InternalComputationValueType = typename ImageToImageMetricv4Type::InternalComputationValueType;
   using NumberOfParametersType = typename ImageToImageMetricv4Type::NumberOfParametersType;
 
+  using CompensatedMeasureType = CompensatedSummation<InternalComputationValueType>;
   using CompensatedDerivativeValueType = CompensatedSummation<DerivativeValueType>;
   using CompensatedDerivativeType = std::vector<CompensatedDerivativeValueType>;
 
@@ -172,8 +173,10 @@ protected:
 
   struct GetValueAndDerivativePerThreadStruct
   {
-    /** Intermediary threaded metric value storage. */
-    InternalComputationValueType Measure;
+    /** Intermediary threaded metric value storage. The value is accumulated
+     * with compensated summation, so that a single precision
+     * InternalComputationValueType does not lose accuracy over many points. */
+    CompensatedMeasureType Measure;
     /** Intermediary threaded metric value storage. */
     DerivativeType Derivatives;
     /** Intermediary threaded metric value storage. This is used only with global transforms. */
@@ -92,7 +92,7 @@ ImageToImageMetricv4GetValueAndDerivativeThreaderBase<TDomainPartitioner,
   for (ThreadIdType workUnit = 0; workUnit < numWorkUnitsUsed; ++workUnit)
   {
     this->m_GetValueAndDerivativePerThreadVariables[workUnit].NumberOfValidPoints = SizeValueType{};
-    this->m_GetValueAndDerivativePerThreadVariables[workUnit].Measure = InternalComputationValueType{};
+    this->m_GetValueAndDerivativePerThreadVariables[workUnit].Measure.ResetToZero();
     if (this->m_Associate->GetComputeDerivative())
     {
       if (this->m_Associate->m_MovingTransform->GetTransformCategory() !=
@@ -151,13 +151,14 @@ ImageToImageMetricv4GetValueAndDerivativeThreaderBase<TDomainPartitioner,
   if (this->m_Associate->VerifyNumberOfValidPoints(this->m_Associate->m_Value,
                                                    *(this->m_Associate->m_DerivativeResult)))
   {
-    this->m_Associate->m_Value = MeasureType{};
     /* Accumulate the metric value from threads and store the average. */
+    CompensatedSummation<MeasureType> value;
+    value.ResetToZero();
     for (ThreadIdType threadId = 0; threadId < numWorkUnitsUsed; ++threadId)
     {
-      this->m_Associate->m_Value += this->m_GetValueAndDerivativePerThreadVariables[threadId].Measure;
+      value += this->m_GetValueAndDerivativePerThreadVariables[threadId].Measure.GetSum();
     }
-    this->m_Associate->m_Value /= this->m_Associate->m_NumberOfValidPoints;
+    this->m_Associate->m_Value = value.GetSum() / this->m_Associate->m_NumberOfValidPoints;
 
     /* For global transforms, calculate the average values */
     if (this->m_Associate->GetComputeDerivative())
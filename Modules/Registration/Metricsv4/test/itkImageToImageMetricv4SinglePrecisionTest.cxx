@@ -0,0 +1,160 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#include "itkCorrelationImageToImageMetricv4.h"
+#include "itkImageRegionIteratorWithIndex.h"
+#include "itkMeanSquaresImageToImageMetricv4.h"
+#include "itkTranslationTransform.h"
+#include "itkMath.h"
+#include "itkTestingMacros.h"
+
+/* Verify that the v4 image metrics computed with a single precision
+ * InternalComputationValueType agree with the double precision results.
+ * The images have a large constant background, so that an uncompensated
+ * single precision accumulation over all points would lose most of the
+ * significant digits of the metric value. */
+
+namespace
+{
+
+constexpr unsigned int Dimension = 2;
+using ImageType = itk::Image<float, Dimension>;
+
+struct MetricResult
+{
+  double              Value;
+  std::vector<double> Derivative;
+};
+
+template <typename TMetric>
+MetricResult
+itkImageToImageMetricv4SinglePrecisionTest_Evaluate(const ImageType * fixedImage, const ImageType * movingImage)
+{
+  using RealType = typename TMetric::InternalComputationValueType;
+  using TransformType = itk::TranslationTransform<RealType, Dimension>;
+
+  auto fixedTransform = TransformType::New();
+  fixedTransform->SetIdentity();
+
+  typename TransformType::ParametersType parameters(Dimension);
+  parameters[0] = 0.5;
+  parameters[1] = -0.25;
+  auto movingTransform = TransformType::New();
+  movingTransform->SetParameters(parameters);
+
+  auto metric = TMetric::New();
+  metric->SetFixedImage(fixedImage);
+  metric->SetMovingImage(movingImage);
+  metric->SetFixedTransform(fixedTransform);
+  metric->SetMovingTransform(movingTransform);
+  metric->SetMaximumNumberOfWorkUnits(4);
+  metric->Initialize();
+
+  typename TMetric::MeasureType    value;
+  typename TMetric::DerivativeType derivative;
+  metric->GetValueAndDerivative(value, derivative);
+
+  MetricResult result;
+  result.Value = value;
+  result.Derivative.assign(derivative.begin(), derivative.end());
+  return result;
+}
+
+bool
+itkImageToImageMetricv4SinglePrecisionTest_Compare(const char *         name,
+                                                   const MetricResult & singleResult,
+                                                   const MetricResult & doubleResult,
+                                                   double               tolerance)
+{
+  std::cout << name << " value: float " << singleResult.Value << ", double " << doubleResult.Value << std::endl;
+
+  bool passed =
+    itk::Math::Absolute(singleResult.Value - doubleResult.Value) <= tolerance * itk::Math::Absolute(doubleResult.Value);
+
+  double derivativeDifference = 0.0;
+  double derivativeNorm = 0.0;
+  for (size_t p = 0; p < doubleResult.Derivative.size(); ++p)
+  {
+    derivativeDifference += itk::Math::sqr(singleResult.Derivative[p] - doubleResult.Derivative[p]);
+    derivativeNorm += itk::Math::sqr(doubleResult.Derivative[p]);
+  }
+  std::cout << name << " relative derivative difference: " << std::sqrt(derivativeDifference / derivativeNorm)
+            << std::endl;
+  passed = passed && std::sqrt(derivativeDifference) <= tolerance * std::sqrt(derivativeNorm);
+
+  if (!passed)
+  {
+    std::cerr << "Test failed!" << std::endl;
+    std::cerr << name << " computed in single precision differs from the double precision result by more than "
+              << tolerance << " (relative)." << std::endl;
+  }
+  return passed;
+}
+
+} // namespace
+
+int
+itkImageToImageMetricv4SinglePrecisionTest(int, char *[])
+{
+  constexpr itk::SizeValueType imageSize = 256;
+  constexpr double             background = 10000.0;
+
+  auto fixedImage = ImageType::New();
+  fixedImage->SetRegions(ImageType::SizeType::Filled(imageSize));
+  fixedImage->Allocate();
+  auto movingImage = ImageType::New();
+  movingImage->SetRegions(ImageType::SizeType::Filled(imageSize));
+  movingImage->Allocate();
+
+  // Smooth, textured images on a large background, the moving one shifted.
+  for (itk::ImageRegionIteratorWithIndex<ImageType> it(fixedImage, fixedImage->GetLargestPossibleRegion());
+       !it.IsAtEnd();
+       ++it)
+  {
+    const double x = it.GetIndex()[0];
+    const double y = it.GetIndex()[1];
+    const double movingValue = background + 100.0 * std::sin((x + 1.0) / 9.0) * std::cos((y - 0.5) / 13.0);
+    it.Set(static_cast<float>(background + 100.0 * std::sin(x / 9.0) * std::cos(y / 13.0)));
+    movingImage->SetPixel(it.GetIndex(), static_cast<float>(movingValue));
+  }
+
+  bool passed = true;
+
+  using MeanSquaresFloatType = itk::MeanSquaresImageToImageMetricv4<ImageType, ImageType, ImageType, float>;
+  using MeanSquaresDoubleType = itk::MeanSquaresImageToImageMetricv4<ImageType, ImageType, ImageType, double>;
+  passed &= itkImageToImageMetricv4SinglePrecisionTest_Compare(
+    "MeanSquares",
+    itkImageToImageMetricv4SinglePrecisionTest_Evaluate<MeanSquaresFloatType>(fixedImage, movingImage),
+    itkImageToImageMetricv4SinglePrecisionTest_Evaluate<MeanSquaresDoubleType>(fixedImage, movingImage),
+    1e-4);
+
+  using CorrelationFloatType = itk::CorrelationImageToImageMetricv4<ImageType, ImageType, ImageType, float>;
+  using CorrelationDoubleType = itk::CorrelationImageToImageMetricv4<ImageType, ImageType, ImageType, double>;
+  passed &= itkImageToImageMetricv4SinglePrecisionTest_Compare(
+    "Correlation",
+    itkImageToImageMetricv4SinglePrecisionTest_Evaluate<CorrelationFloatType>(fixedImage, movingImage),
+    itkImageToImageMetricv4SinglePrecisionTest_Evaluate<CorrelationDoubleType>(fixedImage, movingImage),
+    1e-3);
+
+  if (!passed)
+  {
+    return EXIT_FAILURE;
+  }
+
+  std::cout << "Test finished." << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -231,6 +231,17 @@ public:
    *  Available after Update() has been called. */
   itkGetConstObjectMacro(MovingImageFFT, ComplexImageType);
 
+  /** Compute the fixed (moving) image's FFT unless it has already been
+   *  computed or set, without computing the phase correlation. This allows
+   *  the FFT to be cached before Update() has been called. Requires both
+   *  images to be set. */
+  /** @ITKStartGrouping */
+  void
+  UpdateFixedImageFFT();
+  void
+  UpdateMovingImageFFT();
+  /** @ITKEndGrouping */
+
   /** Passes ReleaseDataFlag to internal filters. */
   void
   SetReleaseDataFlag(bool flag) override;
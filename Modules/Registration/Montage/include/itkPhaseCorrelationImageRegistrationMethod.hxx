@@ -559,6 +559,34 @@ PhaseCorrelationImageRegistrationMethod<TFixedImage, TMovingImage, TInternalPixe
 }
 
 
+template <typename TFixedImage, typename TMovingImage, typename TInternalPixelType>
+void
+PhaseCorrelationImageRegistrationMethod<TFixedImage, TMovingImage, TInternalPixelType>::UpdateFixedImageFFT()
+{
+  if (m_FixedImageFFT.IsNull())
+  {
+    this->UpdateOutputInformation(); // connects the internal pipeline and determines the padding
+    m_FixedFFT->Update();
+    m_FixedImageFFT = m_FixedFFT->GetOutput();
+    m_FixedImageFFT->DisconnectPipeline();
+  }
+}
+
+
+template <typename TFixedImage, typename TMovingImage, typename TInternalPixelType>
+void
+PhaseCorrelationImageRegistrationMethod<TFixedImage, TMovingImage, TInternalPixelType>::UpdateMovingImageFFT()
+{
+  if (m_MovingImageFFT.IsNull())
+  {
+    this->UpdateOutputInformation(); // connects the internal pipeline and determines the padding
+    m_MovingFFT->Update();
+    m_MovingImageFFT = m_MovingFFT->GetOutput();
+    m_MovingImageFFT->DisconnectPipeline();
+  }
+}
+
+
 template <typename TFixedImage, typename TMovingImage, typename TInternalPixelType>
 void
 PhaseCorrelationImageRegistrationMethod<TFixedImage, TMovingImage, TInternalPixelType>::GenerateData()
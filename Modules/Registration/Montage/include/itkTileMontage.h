@@ -285,6 +285,12 @@ protected:
   void
   RegisterPair(TileIndexType fixed, TileIndexType moving);
 
+  /** Cache the FFT of the tile with the given linear index, calling
+   * computeFFT only if no other pair has cached it yet. */
+  template <typename TComputeFFT>
+  void
+  UpdateTileFFT(SizeValueType linearIndex, TComputeFFT computeFFT);
+
   /** If possible, removes from memory tile with index smaller by 1 along all dimensions. */
   void
   ReleaseMemory(TileIndexType finishedTile);
@@ -332,6 +338,8 @@ private:
 
   std::mutex m_MemberProtector; // to prevent concurrent access to non-thread-safe internal member variables
 
+  std::deque<std::mutex> m_FFTLocks; // held while a tile's FFT is computed and cached, so it is computed only once
+
   typename PCMType::PaddingMethodEnum m_PaddingMethod = PCMType::PaddingMethodEnum::MirrorWithExponentialDecay;
 
   std::vector<std::string>       m_Filenames;
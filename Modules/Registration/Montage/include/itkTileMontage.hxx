@@ -110,6 +110,7 @@ TileMontage<TImageType, TCoordinate>::SetMontageSize(SizeType montageSize)
     this->SetNumberOfRequiredOutputs(m_LinearMontageSize);
     m_MontageSize = montageSize;
     m_TileReadLocks.resize(m_LinearMontageSize);
+    m_FFTLocks.resize(m_LinearMontageSize);
     m_Filenames.resize(m_LinearMontageSize);
     m_FFTCache.resize(m_LinearMontageSize);
     m_Tiles.resize(m_LinearMontageSize);
@@ -244,6 +245,24 @@ TileMontage<TImageType, TCoordinate>::ReferenceLinearIndex(DataObjectPointerArra
   return this->nDIndexToLinearIndex(referenceIndex);
 }
 
+template <typename TImageType, typename TCoordinate>
+template <typename TComputeFFT>
+void
+TileMontage<TImageType, TCoordinate>::UpdateTileFFT(SizeValueType linearIndex, TComputeFFT computeFFT)
+{
+  std::lock_guard<std::mutex> fftLock(m_FFTLocks[linearIndex]);
+  {
+    std::lock_guard<std::mutex> lock(m_MemberProtector);
+    if (m_FFTCache[linearIndex].IsNotNull())
+    {
+      return;
+    }
+  }
+  FFTConstPointer fft = computeFFT();
+  std::lock_guard<std::mutex> lock(m_MemberProtector);
+  m_FFTCache[linearIndex] = fft;
+}
+
 template <typename TImageType, typename TCoordinate>
 void
 TileMontage<TImageType, TCoordinate>::RegisterPair(TileIndexType fixed, TileIndexType moving)
@@ -267,6 +286,23 @@ TileMontage<TImageType, TCoordinate>::RegisterPair(TileIndexType fixed, TileInde
   auto mImage = this->GetImage(moving, false);
   m_PCM->SetFixedImage(this->GetImage(fixed, false));
   m_PCM->SetMovingImage(mImage);
+
+  // Each tile takes part in up to 2*ImageDimension pairs, some of which are
+  // registered concurrently. The first pair which needs a tile's FFT computes
+  // it while holding that tile's FFT lock, and the other pairs wait for the
+  // cached result instead of computing it again. The lock is released as soon
+  // as the FFT is cached, so the rest of the registration runs concurrently.
+  if (!m_CropToOverlap)
+  {
+    this->UpdateTileFFT(lFixedInd, [&m_PCM]() -> FFTConstPointer {
+      m_PCM->UpdateFixedImageFFT();
+      return m_PCM->GetFixedImageFFT();
+    });
+    this->UpdateTileFFT(lMovingInd, [&m_PCM]() -> FFTConstPointer {
+      m_PCM->UpdateMovingImageFFT();
+      return m_PCM->GetMovingImageFFT();
+    });
+  }
   // scoping the lock
   {
     std::lock_guard<std::mutex> lock(m_MemberProtector);
@@ -0,0 +1,145 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+#include "itkImageRegionIteratorWithIndex.h"
+#include "itkMersenneTwisterRandomVariateGenerator.h"
+#include "itkRegionOfInterestImageFilter.h"
+#include "itkTestingMacros.h"
+#include "itkTileMontage.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+// Registers a 3x3 montage of synthetic tiles without cropping to the overlap,
+// so that the tile FFTs are cached and shared between concurrently registered
+// pairs, and checks that the result does not depend on the number of work units.
+int
+itkMontageConcurrentRegistrationTest(int, char *[])
+{
+  constexpr unsigned Dimension = 2;
+  using PixelType = unsigned short;
+  using ImageType = itk::Image<PixelType, Dimension>;
+  using MontageType = itk::TileMontage<ImageType, double>;
+  using TileIndexType = MontageType::TileIndexType;
+
+  constexpr itk::SizeValueType tileSize = 64;
+  constexpr itk::SizeValueType tileStride = 32; // tiles overlap by half their size
+  constexpr itk::SizeValueType tilesPerDimension = 3;
+
+  // A sum of random Gaussian blobs gives the phase correlation enough texture.
+  auto image = ImageType::New();
+  image->SetRegions(ImageType::SizeType::Filled(tileStride * (tilesPerDimension - 1) + tileSize));
+  image->AllocateInitialized();
+
+  using GeneratorType = itk::Statistics::MersenneTwisterRandomVariateGenerator;
+  auto generator = GeneratorType::New();
+  generator->Initialize(20240607);
+
+  const ImageType::SizeType imageSize = image->GetLargestPossibleRegion().GetSize();
+  for (unsigned b = 0; b < 100; ++b)
+  {
+    const double cx = generator->GetUniformVariate(0.0, imageSize[0]);
+    const double cy = generator->GetUniformVariate(0.0, imageSize[1]);
+    const double sigma = generator->GetUniformVariate(2.0, 6.0);
+    const double amplitude = generator->GetUniformVariate(200.0, 1000.0);
+
+    for (itk::ImageRegionIteratorWithIndex<ImageType> it(image, image->GetLargestPossibleRegion()); !it.IsAtEnd(); ++it)
+    {
+      const double dx = it.GetIndex()[0] - cx;
+      const double dy = it.GetIndex()[1] - cy;
+      const double value = amplitude * std::exp(-(dx * dx + dy * dy) / (2.0 * sigma * sigma));
+      it.Set(static_cast<PixelType>(std::min(65535.0, it.Get() + value)));
+    }
+  }
+
+  // Cut the tiles at their exact positions.
+  std::vector<ImageType::Pointer> tiles;
+  for (itk::SizeValueType y = 0; y < tilesPerDimension; ++y)
+  {
+    for (itk::SizeValueType x = 0; x < tilesPerDimension; ++x)
+    {
+      ImageType::RegionType tileRegion;
+      tileRegion.SetIndex(0, x * tileStride);
+      tileRegion.SetIndex(1, y * tileStride);
+      tileRegion.SetSize(ImageType::SizeType::Filled(tileSize));
+
+      using ROIFilterType = itk::RegionOfInterestImageFilter<ImageType, ImageType>;
+      auto roi = ROIFilterType::New();
+      roi->SetInput(image);
+      roi->SetRegionOfInterest(tileRegion);
+      roi->Update();
+      tiles.emplace_back(roi->GetOutput());
+      tiles.back()->DisconnectPipeline();
+    }
+  }
+
+  const auto montageSize = MontageType::SizeType::Filled(tilesPerDimension);
+
+  // Register the montage using the given number of work units,
+  // returning the translation found for each tile.
+  const auto registerMontage = [&](itk::ThreadIdType workUnits) {
+    auto montage = MontageType::New();
+    montage->SetMontageSize(montageSize);
+    montage->SetCropToOverlap(false);
+    montage->SetNumberOfWorkUnits(workUnits);
+    for (itk::SizeValueType t = 0; t < tiles.size(); ++t)
+    {
+      montage->SetInputTile(t, tiles[t]);
+    }
+    montage->Update();
+
+    std::vector<MontageType::TransformType::OutputVectorType> translations;
+    TileIndexType                                             tileIndex;
+    for (tileIndex[1] = 0; tileIndex[1] < tilesPerDimension; ++tileIndex[1])
+    {
+      for (tileIndex[0] = 0; tileIndex[0] < tilesPerDimension; ++tileIndex[0])
+      {
+        translations.push_back(montage->GetOutputTransform(tileIndex)->GetOffset());
+      }
+    }
+    return translations;
+  };
+
+  std::vector<MontageType::TransformType::OutputVectorType> serialTranslations;
+  ITK_TRY_EXPECT_NO_EXCEPTION(serialTranslations = registerMontage(1));
+  std::vector<MontageType::TransformType::OutputVectorType> concurrentTranslations;
+  ITK_TRY_EXPECT_NO_EXCEPTION(concurrentTranslations = registerMontage(4));
+
+  int result = EXIT_SUCCESS;
+  for (itk::SizeValueType t = 0; t < serialTranslations.size(); ++t)
+  {
+    std::cout << "Tile " << t << ": " << concurrentTranslations[t] << std::endl;
+    if (serialTranslations[t] != concurrentTranslations[t])
+    {
+      std::cerr << "Test failed!" << std::endl;
+      std::cerr << "Tile " << t << " translation with 4 work units " << concurrentTranslations[t]
+                << " differs from the one with 1 work unit " << serialTranslations[t] << std::endl;
+      result = EXIT_FAILURE;
+    }
+    if (concurrentTranslations[t].GetNorm() > 0.5)
+    {
+      std::cerr << "Test failed!" << std::endl;
+      std::cerr << "Tile " << t << " was cut at its nominal position, but is translated by "
+                << concurrentTranslations[t] << std::endl;
+      result = EXIT_FAILURE;
+    }
+  }
+
+  std::cout << "Test finished." << std::endl;
+  return result;
+}
@@ -59,6 +59,12 @@ namespace itk
  * smoothing the displacement field. Both buffers are the same type and size as the
  * output displacement field.
  *
+ * When UseRecursiveGaussianSmoothing is enabled, the fields are instead smoothed
+ * in place with a recursive (IIR) Gaussian filter. Its cost per pixel does not
+ * depend on the standard deviations, and the double-buffering field is not
+ * allocated. The recursive filter approximates the Gaussian less accurately than
+ * the truncated kernel for standard deviations below about one pixel.
+ *
  * This class make use of the finite difference solver hierarchy. Update
  * for each iteration is computed using a PDEDeformableRegistrationFunction.
  *
@@ -212,6 +218,20 @@ public:
   itkSetMacro(MaximumKernelWidth, unsigned int);
   itkGetConstMacro(MaximumKernelWidth, unsigned int);
   /** @ITKEndGrouping */
+
+  /** Set/Get whether the displacement and update fields are smoothed in
+   * place with a recursive Gaussian filter instead of a truncated Gaussian
+   * kernel. MaximumError and MaximumKernelWidth are ignored when this is on.
+   * The recursive filter needs at least 4 pixels along each direction; smaller
+   * fields, as found at the coarse levels of
+   * MultiResolutionPDEDeformableRegistration, are smoothed with the truncated
+   * Gaussian kernel regardless. Default is off.
+   * \sa SmoothingRecursiveGaussianImageFilter */
+  /** @ITKStartGrouping */
+  itkSetMacro(UseRecursiveGaussianSmoothing, bool);
+  itkGetConstMacro(UseRecursiveGaussianSmoothing, bool);
+  itkBooleanMacro(UseRecursiveGaussianSmoothing);
+  /** @ITKEndGrouping */
 protected:
   PDEDeformableRegistrationFilter();
   ~PDEDeformableRegistrationFilter() override = default;
@@ -254,6 +274,16 @@ protected:
   virtual void
   SmoothUpdateField();
 
+  /** Return whether the given field is large enough to be smoothed with a
+   * recursive Gaussian filter. */
+  bool
+  CanSmoothWithRecursiveGaussian(const DisplacementFieldType * field) const;
+
+  /** Smooth the given field in place with a recursive Gaussian filter. The
+   * standard deviations are given in pixel coordinates. */
+  void
+  SmoothFieldWithRecursiveGaussian(DisplacementFieldType * field, const StandardDeviationsType & standardDeviations);
+
   /** Release the memory of the internal buffers.
    *
    * Called after the solution has been generated.
@@ -293,6 +323,8 @@ private:
   bool m_SmoothDisplacementField{};
   bool m_SmoothUpdateField{};
 
+  bool m_UseRecursiveGaussianSmoothing{ false };
+
   /** Temporary displacement field use for smoothing the
    * the displacement field. */
   DisplacementFieldPointer m_TempField{};
@@ -24,6 +24,7 @@
 
 #include "itkGaussianOperator.h"
 #include "itkVectorNeighborhoodOperatorImageFilter.h"
+#include "itkSmoothingRecursiveGaussianImageFilter.h"
 
 #include "itkMath.h"
 
@@ -121,6 +122,7 @@ PDEDeformableRegistrationFilter<TFixedImage, TMovingImage, TDisplacementField>::
   os << indent << "MaximumError: " << m_MaximumError << std::endl;
   os << indent << "MaximumKernelWidth: " << m_MaximumKernelWidth << std::endl;
   itkPrintSelfBooleanMacro(StopRegistrationFlag);
+  itkPrintSelfBooleanMacro(UseRecursiveGaussianSmoothing);
 }
 
 template <typename TFixedImage, typename TMovingImage, typename TDisplacementField>
@@ -259,6 +261,12 @@ PDEDeformableRegistrationFilter<TFixedImage, TMovingImage, TDisplacementField>::
 {
   const DisplacementFieldPointer field = this->GetOutput();
 
+  if (m_UseRecursiveGaussianSmoothing && this->CanSmoothWithRecursiveGaussian(field))
+  {
+    this->SmoothFieldWithRecursiveGaussian(field, m_StandardDeviations);
+    return;
+  }
+
   // copy field to TempField
   m_TempField->SetOrigin(field->GetOrigin());
   m_TempField->SetSpacing(field->GetSpacing());
@@ -319,6 +327,12 @@ PDEDeformableRegistrationFilter<TFixedImage, TMovingImage, TDisplacementField>::
   // The update buffer will be overwritten with new data.
   const DisplacementFieldPointer field = this->GetUpdateBuffer();
 
+  if (m_UseRecursiveGaussianSmoothing && this->CanSmoothWithRecursiveGaussian(field))
+  {
+    this->SmoothFieldWithRecursiveGaussian(field, this->GetUpdateFieldStandardDeviations());
+    return;
+  }
+
   using VectorType = typename DisplacementFieldType::PixelType;
   using ScalarType = typename VectorType::ValueType;
   using OperatorType = GaussianOperator<ScalarType, ImageDimension>;
@@ -359,6 +373,57 @@ PDEDeformableRegistrationFilter<TFixedImage, TMovingImage, TDisplacementField>::
   field->SetLargestPossibleRegion(smoothers[ImageDimension - 1]->GetOutput()->GetLargestPossibleRegion());
   field->CopyInformation(smoothers[ImageDimension - 1]->GetOutput());
 }
+
+template <typename TFixedImage, typename TMovingImage, typename TDisplacementField>
+bool
+PDEDeformableRegistrationFilter<TFixedImage, TMovingImage, TDisplacementField>::CanSmoothWithRecursiveGaussian(
+  const DisplacementFieldType * field) const
+{
+  // RecursiveSeparableImageFilter needs at least 4 pixels along each direction.
+  const typename DisplacementFieldType::SizeType & size = field->GetBufferedRegion().GetSize();
+  for (unsigned int j = 0; j < ImageDimension; ++j)
+  {
+    if (size[j] < 4)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <typename TFixedImage, typename TMovingImage, typename TDisplacementField>
+void
+PDEDeformableRegistrationFilter<TFixedImage, TMovingImage, TDisplacementField>::SmoothFieldWithRecursiveGaussian(
+  DisplacementFieldType *        field,
+  const StandardDeviationsType & standardDeviations)
+{
+  using SmootherType = SmoothingRecursiveGaussianImageFilter<DisplacementFieldType, DisplacementFieldType>;
+
+  // The recursive filter measures sigma in physical units, while the
+  // standard deviations are given in pixel coordinates.
+  typename SmootherType::SigmaArrayType sigmas;
+  for (unsigned int j = 0; j < ImageDimension; ++j)
+  {
+    sigmas[j] = standardDeviations[j] * field->GetSpacing()[j];
+  }
+
+  auto smoother = SmootherType::New();
+  smoother->SetSigmaArray(sigmas);
+  smoother->SetNumberOfWorkUnits(this->GetNumberOfWorkUnits());
+  smoother->SetInput(field);
+  smoother->InPlaceOn();
+  smoother->GetOutput()->SetRequestedRegion(field->GetBufferedRegion());
+  smoother->Update();
+
+  // Running in place, the smoother took over the buffer of the field and
+  // released the field itself; hand the buffer back.
+  const typename DisplacementFieldType::Pointer smoothed = smoother->GetOutput();
+  field->SetPixelContainer(smoothed->GetPixelContainer());
+  field->SetLargestPossibleRegion(smoothed->GetLargestPossibleRegion());
+  field->SetRequestedRegion(smoothed->GetRequestedRegion());
+  field->SetBufferedRegion(smoothed->GetBufferedRegion());
+  field->CopyInformation(smoothed);
+}
 } // end namespace itk
 
 #endif
@@ -222,6 +222,9 @@ itkDemonsRegistrationFilterTest(int, char *[])
   registrator->SetUpdateFieldStandardDeviations(updateFieldStandardDeviations);
   ITK_TEST_SET_GET_VALUE(updateFieldStandardDeviations, registrator->GetUpdateFieldStandardDeviations());
 
+  auto useRecursiveGaussianSmoothing = false;
+  ITK_TEST_SET_GET_BOOLEAN(registrator, UseRecursiveGaussianSmoothing, useRecursiveGaussianSmoothing);
+
   // turn on inplace execution
   auto inPlace = true;
   ITK_TEST_SET_GET_BOOLEAN(registrator, InPlace, inPlace);
@@ -290,6 +293,32 @@ itkDemonsRegistrationFilterTest(int, char *[])
     return EXIT_FAILURE;
   }
 
+  std::cout << "Test smoothing the fields in place with a recursive Gaussian." << std::endl;
+
+  registrator->UseRecursiveGaussianSmoothingOn();
+
+  ITK_TRY_EXPECT_NO_EXCEPTION(warper->Update());
+
+  numPixelsDifferent = 0;
+  itk::ImageRegionConstIterator<ImageType> recursiveWarpedIter(warper->GetOutput(), fixed->GetBufferedRegion());
+  for (fixedIter.GoToBegin(); !fixedIter.IsAtEnd(); ++fixedIter, ++recursiveWarpedIter)
+  {
+    if (fixedIter.Get() != recursiveWarpedIter.Get())
+    {
+      numPixelsDifferent++;
+    }
+  }
+
+  std::cout << "Number of pixels different: " << numPixelsDifferent << std::endl;
+
+  if (numPixelsDifferent > 10)
+  {
+    std::cout << "Test failed - too many pixels different with recursive Gaussian smoothing." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  registrator->UseRecursiveGaussianSmoothingOff();
+
   std::cout << "IntensityDifferenceThreshold: " << registrator->GetIntensityDifferenceThreshold() << std::endl;
 
   registrator->Print(std::cout);
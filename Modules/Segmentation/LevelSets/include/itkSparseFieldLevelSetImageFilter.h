@@ -388,7 +388,9 @@ protected:
   ApplyUpdate(const TimeStepType & dt) override;
 
   /** Traverses the active layer list and calculates the change at these
-   *  indices to be applied in the current iteration. */
+   *  indices to be applied in the current iteration. The active layer is
+   *  split into runs of nodes of the same length, which are processed by the
+   *  work units in parallel. */
   TimeStepType
   CalculateChange() override;
 
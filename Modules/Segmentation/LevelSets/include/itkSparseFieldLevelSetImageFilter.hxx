@@ -823,96 +823,134 @@ SparseFieldLevelSetImageFilter<TInputImage, TOutputImage>::CalculateChange() ->
     MIN_NORM *= minSpacing;
   }
 
-  void * globalData = df->GetGlobalDataPointer();
-
-  NeighborhoodIterator<OutputImageType> outputIt(
-    df->GetRadius(), this->m_OutputImage, this->m_OutputImage->GetRequestedRegion());
-
-  if (m_BoundsCheckingActive == false)
+  // Split the active layer into runs of consecutive nodes, one per work
+  // unit, each with about the same number of nodes. The split is redone at
+  // every iteration, so that the work units stay balanced as the front
+  // moves. Small layers are not split, as the overhead of the threads would
+  // exceed the gain.
+  constexpr SizeValueType minimumNumberOfNodesPerChunk = 512;
+
+  const LayerType &   activeLayer = *m_Layers[0];
+  const SizeValueType numberOfNodes = activeLayer.Size();
+  const SizeValueType numberOfChunks = std::max<SizeValueType>(
+    1, std::min<SizeValueType>(this->GetNumberOfWorkUnits(), numberOfNodes / minimumNumberOfNodesPerChunk));
+
+  std::vector<SizeValueType>                     chunkStarts(numberOfChunks + 1, numberOfNodes);
+  std::vector<typename LayerType::ConstIterator> chunkBegins(numberOfChunks + 1, activeLayer.End());
+  typename LayerType::ConstIterator              layerIt = activeLayer.Begin();
+  SizeValueType                                  position = 0;
+  for (SizeValueType chunk = 0; chunk < numberOfChunks; ++chunk)
   {
-    outputIt.NeedToUseBoundaryConditionOff();
+    chunkStarts[chunk] = chunk * numberOfNodes / numberOfChunks;
+    for (; position < chunkStarts[chunk]; ++position)
+    {
+      ++layerIt;
+    }
+    chunkBegins[chunk] = layerIt;
   }
 
-  m_UpdateBuffer.clear();
-  m_UpdateBuffer.reserve(m_Layers[0]->Size());
+  m_UpdateBuffer.resize(numberOfNodes);
 
-  // Calculates the update values for the active layer indices in this
-  // iteration.  Iterates through the active layer index list, applying
-  // the level set function to the output image (level set image) at each
-  // index.  Update values are stored in the update buffer.
-  for (auto layerIt = m_Layers[0]->Begin(); layerIt != m_Layers[0]->End(); ++layerIt)
-  {
-    outputIt.SetLocation(layerIt->m_Value);
+  std::vector<TimeStepType> timeStepList(numberOfChunks);
+  BooleanStdVectorType      validTimeStepList(numberOfChunks, true);
+
+  // Calculates the update values for the active layer indices of a chunk.
+  // Iterates through the nodes of the chunk, applying the level set function
+  // to the output image (level set image) at each index.  Update values are
+  // stored in the update buffer, at the position of their node in the layer.
+  // Each chunk has its own global data, from which the function computes the
+  // time step of the chunk.
+  const auto calculateChunkChange = [this, df, MIN_NORM, &chunkStarts, &chunkBegins, &timeStepList](
+                                      SizeValueType chunk) {
+    void * globalData = df->GetGlobalDataPointer();
+
+    NeighborhoodIterator<OutputImageType> outputIt(
+      df->GetRadius(), this->m_OutputImage, this->m_OutputImage->GetRequestedRegion());
 
-    // Calculate the offset to the surface from the center of this
-    // neighborhood.  This is used by some level set functions in sampling a
-    // speed, advection, or curvature term.
-    ValueType centerValue;
-    if (this->GetInterpolateSurfaceLocation() && (centerValue = outputIt.GetCenterPixel()) != 0.0)
+    if (m_BoundsCheckingActive == false)
     {
-      // Surface is at the zero crossing, so distance to surface is:
-      // phi(x) / norm(grad(phi)), where phi(x) is the center of the
-      // neighborhood.  The location is therefore
-      // (i,j,k) - ( phi(x) * grad(phi(x)) ) / norm(grad(phi))^2
-      ValueType norm_grad_phi_squared = 0.0;
+      outputIt.NeedToUseBoundaryConditionOff();
+    }
 
-      typename Superclass::FiniteDifferenceFunctionType::FloatOffsetType offset;
-      for (unsigned int i = 0; i < ImageDimension; ++i)
+    auto updateIt = m_UpdateBuffer.begin() + chunkStarts[chunk];
+    for (auto nodeIt = chunkBegins[chunk]; nodeIt != chunkBegins[chunk + 1]; ++nodeIt, ++updateIt)
+    {
+      outputIt.SetLocation(nodeIt->m_Value);
+
+      // Calculate the offset to the surface from the center of this
+      // neighborhood.  This is used by some level set functions in sampling a
+      // speed, advection, or curvature term.
+      ValueType centerValue;
+      if (this->GetInterpolateSurfaceLocation() && (centerValue = outputIt.GetCenterPixel()) != 0.0)
       {
-        const auto forwardValue = outputIt.GetNext(i);
-        const auto backwardValue = outputIt.GetPrevious(i);
+        // Surface is at the zero crossing, so distance to surface is:
+        // phi(x) / norm(grad(phi)), where phi(x) is the center of the
+        // neighborhood.  The location is therefore
+        // (i,j,k) - ( phi(x) * grad(phi(x)) ) / norm(grad(phi))^2
+        ValueType norm_grad_phi_squared = 0.0;
+
+        typename Superclass::FiniteDifferenceFunctionType::FloatOffsetType offset;
+        for (unsigned int i = 0; i < ImageDimension; ++i)
+        {
+          const auto forwardValue = outputIt.GetNext(i);
+          const auto backwardValue = outputIt.GetPrevious(i);
 
-        if (forwardValue * backwardValue >= 0)
-        { //  Neighbors are same sign OR at least one neighbor is zero.
-          const auto dx_forward = forwardValue - centerValue;
-          const auto dx_backward = centerValue - backwardValue;
+          if (forwardValue * backwardValue >= 0)
+          { //  Neighbors are same sign OR at least one neighbor is zero.
+            const auto dx_forward = forwardValue - centerValue;
+            const auto dx_backward = centerValue - backwardValue;
 
-          // Pick the larger magnitude derivative.
-          if (itk::Math::Absolute(dx_forward) > itk::Math::Absolute(dx_backward))
-          {
-            offset[i] = dx_forward;
+            // Pick the larger magnitude derivative.
+            if (itk::Math::Absolute(dx_forward) > itk::Math::Absolute(dx_backward))
+            {
+              offset[i] = dx_forward;
+            }
+            else
+            {
+              offset[i] = dx_backward;
+            }
           }
-          else
+          else // Neighbors are opposite sign, pick the direction of the 0 surface.
           {
-            offset[i] = dx_backward;
+            if (forwardValue * centerValue < 0)
+            {
+              offset[i] = forwardValue - centerValue;
+            }
+            else
+            {
+              offset[i] = centerValue - backwardValue;
+            }
           }
+
+          norm_grad_phi_squared += offset[i] * offset[i];
         }
-        else // Neighbors are opposite sign, pick the direction of the 0 surface.
+
+        for (unsigned int i = 0; i < ImageDimension; ++i)
         {
-          if (forwardValue * centerValue < 0)
-          {
-            offset[i] = forwardValue - centerValue;
-          }
-          else
-          {
-            offset[i] = centerValue - backwardValue;
-          }
+          offset[i] = (offset[i] * centerValue) / (norm_grad_phi_squared + MIN_NORM);
         }
 
-        norm_grad_phi_squared += offset[i] * offset[i];
+        *updateIt = df->ComputeUpdate(outputIt, globalData, offset);
       }
-
-      for (unsigned int i = 0; i < ImageDimension; ++i)
+      else // Don't do interpolation
       {
-        offset[i] = (offset[i] * centerValue) / (norm_grad_phi_squared + MIN_NORM);
+        *updateIt = df->ComputeUpdate(outputIt, globalData);
       }
-
-      m_UpdateBuffer.push_back(df->ComputeUpdate(outputIt, globalData, offset));
-    }
-    else // Don't do interpolation
-    {
-      m_UpdateBuffer.push_back(df->ComputeUpdate(outputIt, globalData));
     }
-  }
 
-  // Ask the finite difference function to compute the time step for
-  // this iteration.  We give it the global data pointer to use, then
-  // ask it to free the global data memory.
-  const auto timeStep = df->ComputeGlobalTimeStep(globalData);
+    // Ask the finite difference function to compute the time step for
+    // this chunk.  We give it the global data pointer to use, then
+    // ask it to free the global data memory.
+    timeStepList[chunk] = df->ComputeGlobalTimeStep(globalData);
+
+    df->ReleaseGlobalDataPointer(globalData);
+  };
 
-  df->ReleaseGlobalDataPointer(globalData);
+  this->GetMultiThreader()->SetNumberOfWorkUnits(this->GetNumberOfWorkUnits());
+  this->GetMultiThreader()->ParallelizeArray(0, numberOfChunks, calculateChunkChange, nullptr);
 
-  return timeStep;
+  // The time step of the iteration is the smallest time step of the chunks.
+  return this->ResolveTimeStep(timeStepList, validTimeStepList);
 }
 
 template <typename TInputImage, typename TOutputImage>
@@ -114,6 +114,7 @@ BinaryImageToLevelSetImageAdaptor<TInput, WhitakerSparseLevelSetImage<TOutput, T
   this->m_LabelMap->Optimize();
 
   this->m_LevelSet->SetLabelMap(this->m_LabelMap);
+  this->m_LevelSet->ComputeStatusImage();
 
   // release the memory
   this->m_InternalImage = nullptr;
@@ -376,6 +377,7 @@ BinaryImageToLevelSetImageAdaptor<TInput, ShiSparseLevelSetImage<TInput::ImageDi
   FindActiveLayer();
 
   this->m_LevelSet->SetLabelMap(this->m_LabelMap);
+  this->m_LevelSet->ComputeStatusImage();
   this->m_InternalImage = nullptr;
 }
 
@@ -520,6 +522,7 @@ BinaryImageToLevelSetImageAdaptor<TInput, MalcolmSparseLevelSetImage<TInput::Ima
   this->CreateMinimalInterface();
 
   this->m_LevelSet->SetLabelMap(this->m_LabelMap);
+  this->m_LevelSet->ComputeStatusImage();
   this->m_InternalImage = nullptr;
 }
 
@@ -37,7 +37,7 @@ LevelSetEquationChanAndVeseExternalTerm<TInput, TLevelSetContainer>::ComputeProd
                                                                                     LevelSetOutputRealType &       prod)
 {
   this->ComputeProductTerm(iP, prod);
-  const LevelSetPointer        levelSet = this->m_LevelSetContainer->GetLevelSet(this->m_CurrentLevelSetId);
+  const LevelSetType *         levelSet = this->m_LevelSetContainer->GetLevelSet(this->m_CurrentLevelSetId);
   const LevelSetOutputRealType value = levelSet->Evaluate(iP);
   prod *= -(1 - this->m_Heaviside->Evaluate(-value));
 }
@@ -60,15 +60,15 @@ LevelSetEquationChanAndVeseExternalTerm<TInput, TLevelSetContainer>::ComputeProd
     const LevelSetIdentifierType id = this->m_CacheImage->GetPixel(iP);
 
     using DomainMapType = typename DomainMapImageFilterType::DomainMapType;
-    const DomainMapType domainMap = this->m_DomainMapImageFilter->GetDomainMap();
-    auto                levelSetMapItr = domainMap.find(id);
+    const DomainMapType & domainMap = this->m_DomainMapImageFilter->GetDomainMap();
+    auto                  levelSetMapItr = domainMap.find(id);
 
     if (levelSetMapItr != domainMap.end())
     {
       const IdListType * idList = levelSetMapItr->second.GetIdList();
 
       LevelSetIdentifierType kk;
-      LevelSetPointer        levelSet;
+      const LevelSetType *   levelSet;
       LevelSetOutputRealType value;
 
       auto idListIt = idList->begin();
@@ -89,7 +89,7 @@ LevelSetEquationChanAndVeseExternalTerm<TInput, TLevelSetContainer>::ComputeProd
   else
   {
     LevelSetIdentifierType kk;
-    LevelSetPointer        levelSet;
+    const LevelSetType *   levelSet;
     LevelSetOutputRealType value;
 
     typename LevelSetContainerType::Iterator lsIt = this->m_LevelSetContainer->Begin();
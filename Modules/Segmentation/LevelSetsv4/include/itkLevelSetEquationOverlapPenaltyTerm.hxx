@@ -79,8 +79,8 @@ LevelSetEquationOverlapPenaltyTerm<TInput, TLevelSetContainer>::ComputeSumTerm(c
     const LevelSetIdentifierType idx = this->m_CacheImage->GetPixel(index);
 
     using DomainMapType = typename DomainMapImageFilterType::DomainMapType;
-    const DomainMapType domainMap = this->m_DomainMapImageFilter->GetDomainMap();
-    auto                levelSetMapItr = domainMap.find(idx);
+    const DomainMapType & domainMap = this->m_DomainMapImageFilter->GetDomainMap();
+    auto                  levelSetMapItr = domainMap.find(idx);
 
     if (levelSetMapItr != domainMap.end())
     {
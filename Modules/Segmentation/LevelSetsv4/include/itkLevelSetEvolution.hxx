@@ -68,9 +68,9 @@ LevelSetEvolution<TEquationContainer, LevelSetDenseImage<TImage>>::ComputeIterat
     const typename DomainMapImageFilterType::ConstPointer domainMapFilter =
       this->m_LevelSetContainer->GetDomainMapFilter();
     using DomainMapType = typename DomainMapImageFilterType::DomainMapType;
-    const DomainMapType domainMap = domainMapFilter->GetDomainMap();
-    auto                mapIt = domainMap.begin();
-    auto                mapEnd = domainMap.end();
+    const DomainMapType & domainMap = domainMapFilter->GetDomainMap();
+    auto                  mapIt = domainMap.begin();
+    auto                  mapEnd = domainMap.end();
 
     const ThreadIdType maximumNumberOfThreads =
       this->m_SplitDomainMapComputeIterationThreader->GetMaximumNumberOfThreads();
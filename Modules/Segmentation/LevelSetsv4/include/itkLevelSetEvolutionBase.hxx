@@ -143,9 +143,9 @@ LevelSetEvolutionBase<TEquationContainer, TLevelSet>::InitializeIteration()
     const typename DomainMapImageFilterType::ConstPointer domainMapFilter =
       this->m_LevelSetContainer->GetDomainMapFilter();
     using DomainMapType = typename DomainMapImageFilterType::DomainMapType;
-    const DomainMapType domainMap = domainMapFilter->GetDomainMap();
-    auto                mapIt = domainMap.begin();
-    auto                mapEnd = domainMap.end();
+    const DomainMapType & domainMap = domainMapFilter->GetDomainMap();
+    auto                  mapIt = domainMap.begin();
+    auto                  mapEnd = domainMap.end();
 
     while (mapIt != mapEnd)
     {
@@ -167,7 +167,7 @@ LevelSetEvolutionBase<TEquationContainer, TLevelSet>::InitializeIteration()
         while (idListIt != idList->end())
         {
           //! \todo Fix me for string identifiers
-          const TermContainerPointer termContainer = this->m_EquationContainer->GetEquation(*idListIt - 1);
+          TermContainerType * const termContainer = this->m_EquationContainer->GetEquation(*idListIt - 1);
           termContainer->Initialize(it.GetIndex());
           ++idListIt;
         }
@@ -24,6 +24,7 @@
 
 #include "itkLabelObject.h"
 #include "itkLabelMap.h"
+#include "itkImage.h"
 #include "itkLexicographicCompare.h"
 
 namespace itk
@@ -74,6 +75,9 @@ public:
   using LabelMapConstPointer = typename LabelMapType::ConstPointer;
   using RegionType = typename LabelMapType::RegionType;
 
+  using StatusImageType = Image<LayerIdType, VDimension>;
+  using StatusImagePointer = typename StatusImageType::Pointer;
+
   using LayerType = std::map<InputType, OutputType, Functor::LexicographicCompare>;
   using LayerIterator = typename LayerType::iterator;
   using LayerConstIterator = typename LayerType::const_iterator;
@@ -104,6 +108,23 @@ public:
   SetLabelMap(LabelMapType * labelMap);
   itkGetModifiableObjectMacro(LabelMap, LabelMapType);
   /** @ITKEndGrouping */
+
+  /** Set/Get the image of the layer id of each pixel of the label map. It
+   * is optional: when it is set, Status() and Evaluate() read it in constant
+   * time instead of searching the lines of the label map. It must match the
+   * label map, so that SetLabelMap() releases it. The update filters, which
+   * compute the layer ids as an image anyway, set it along with the updated
+   * label map. */
+  /** @ITKStartGrouping */
+  virtual void
+  SetStatusImage(StatusImageType * statusImage);
+  itkGetConstObjectMacro(StatusImage, StatusImageType);
+  /** @ITKEndGrouping */
+
+  /** Computes the status image from the label map. */
+  void
+  ComputeStatusImage();
+
   /** Graft data object as level set object */
   void
   Graft(const DataObject * data) override;
@@ -117,9 +138,32 @@ protected:
   LevelSetSparseImage() = default;
   ~LevelSetSparseImage() override = default;
 
-  LayerMapType    m_Layers{};
-  LabelMapPointer m_LabelMap{};
-  LayerIdListType m_InternalLabelList{};
+  LayerMapType       m_Layers{};
+  LabelMapPointer    m_LabelMap{};
+  StatusImagePointer m_StatusImage{};
+  LayerIdListType    m_InternalLabelList{};
+
+  /** Sets status to the layer id of the specified index of the label map
+   * domain, read from the status image, and returns true. Returns false when
+   * there is no status image, or when the index is outside of it. */
+  bool
+  GetStatusFromImage(const InputType & mapIndex, LayerIdType & status) const
+  {
+    if (m_StatusImage.IsNull() || !m_StatusImage->GetBufferedRegion().IsInside(mapIndex))
+    {
+      return false;
+    }
+    status = m_StatusImage->GetPixel(mapIndex);
+    return true;
+  }
+
+  /** Returns the value of the specified index of the label map domain, read
+   * from the status image and from the layer of its status, and returns true.
+   * Returns false when there is no status image, when the index is outside of
+   * it, or when the index is not found in the layer of its status. Outside
+   * of the sparse layers, the value is the status itself. */
+  bool
+  EvaluateFromStatusImage(const InputType & mapIndex, OutputType & value) const;
 
   /** Initialize the sparse field layers */
   virtual void
@@ -19,6 +19,7 @@
 #ifndef itkLevelSetSparseImage_hxx
 #define itkLevelSetSparseImage_hxx
 
+#include "itkLabelMapToLabelImageFilter.h"
 
 namespace itk
 {
@@ -28,15 +29,49 @@ auto
 LevelSetSparseImage<TOutput, VDimension>::Status(const InputType & inputIndex) const -> LayerIdType
 {
   const InputType mapIndex = inputIndex - this->m_DomainOffset;
+
+  LayerIdType status;
+  if (this->GetStatusFromImage(mapIndex, status))
+  {
+    return status;
+  }
   return this->m_LabelMap->GetPixel(mapIndex);
 }
 
 
+template <typename TOutput, unsigned int VDimension>
+bool
+LevelSetSparseImage<TOutput, VDimension>::EvaluateFromStatusImage(const InputType & mapIndex, OutputType & value) const
+{
+  LayerIdType status;
+  if (!this->GetStatusFromImage(mapIndex, status))
+  {
+    return false;
+  }
+
+  const auto layerIt = m_Layers.find(status);
+  if (layerIt == m_Layers.end())
+  {
+    value = static_cast<OutputType>(status);
+    return true;
+  }
+
+  const auto it = layerIt->second.find(mapIndex);
+  if (it == layerIt->second.end())
+  {
+    return false;
+  }
+  value = it->second;
+  return true;
+}
+
+
 template <typename TOutput, unsigned int VDimension>
 void
 LevelSetSparseImage<TOutput, VDimension>::SetLabelMap(LabelMapType * labelMap)
 {
   this->m_LabelMap = labelMap;
+  this->m_StatusImage = nullptr;
 
   using SpacingType = typename LabelMapType::SpacingType;
 
@@ -51,6 +86,38 @@ LevelSetSparseImage<TOutput, VDimension>::SetLabelMap(LabelMapType * labelMap)
 }
 
 
+template <typename TOutput, unsigned int VDimension>
+void
+LevelSetSparseImage<TOutput, VDimension>::SetStatusImage(StatusImageType * statusImage)
+{
+  if (this->m_StatusImage != statusImage)
+  {
+    this->m_StatusImage = statusImage;
+    this->Modified();
+  }
+}
+
+
+template <typename TOutput, unsigned int VDimension>
+void
+LevelSetSparseImage<TOutput, VDimension>::ComputeStatusImage()
+{
+  if (this->m_LabelMap.IsNull())
+  {
+    itkGenericExceptionMacro("m_LabelMap is nullptr");
+  }
+
+  using LabelMapToLabelImageFilterType = LabelMapToLabelImageFilter<LabelMapType, StatusImageType>;
+  auto labelMapToLabelImageFilter = LabelMapToLabelImageFilterType::New();
+  labelMapToLabelImageFilter->SetInput(this->m_LabelMap);
+  labelMapToLabelImageFilter->Update();
+
+  const StatusImagePointer statusImage = labelMapToLabelImageFilter->GetOutput();
+  statusImage->DisconnectPipeline();
+  this->SetStatusImage(statusImage);
+}
+
+
 template <typename TOutput, unsigned int VDimension>
 bool
 LevelSetSparseImage<TOutput, VDimension>::IsInsideDomain(const InputType & inputIndex) const
@@ -84,6 +151,7 @@ LevelSetSparseImage<TOutput, VDimension>::Graft(const DataObject * data)
     LayerMapType newLayers(levelSet->m_Layers);
     std::swap(m_Layers, newLayers);
   }
+  this->m_StatusImage = levelSet->m_StatusImage;
 }
 
 
@@ -136,6 +204,7 @@ LevelSetSparseImage<TOutput, VDimension>::Initialize()
   Superclass::Initialize();
 
   this->m_LabelMap = nullptr;
+  this->m_StatusImage = nullptr;
   this->InitializeLayers();
   this->InitializeInternalLabelList();
 }
@@ -36,7 +36,14 @@ auto
 MalcolmSparseLevelSetImage<VDimension>::Evaluate(const InputType & inputPixel) const -> OutputType
 {
   const InputType mapIndex = inputPixel - this->m_DomainOffset;
-  auto            layerIt = this->m_Layers.begin();
+
+  OutputType value;
+  if (this->EvaluateFromStatusImage(mapIndex, value))
+  {
+    return value;
+  }
+
+  auto layerIt = this->m_Layers.begin();
 
   while (layerIt != this->m_Layers.end())
   {
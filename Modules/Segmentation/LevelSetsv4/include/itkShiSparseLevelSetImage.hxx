@@ -35,7 +35,14 @@ auto
 ShiSparseLevelSetImage<VDimension>::Evaluate(const InputType & inputIndex) const -> OutputType
 {
   const InputType mapIndex = inputIndex - this->m_DomainOffset;
-  auto            layerIt = this->m_Layers.begin();
+
+  OutputType value;
+  if (this->EvaluateFromStatusImage(mapIndex, value))
+  {
+    return value;
+  }
+
+  auto layerIt = this->m_Layers.begin();
 
   while (layerIt != this->m_Layers.end())
   {
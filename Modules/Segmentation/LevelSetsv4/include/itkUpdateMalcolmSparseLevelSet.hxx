@@ -20,6 +20,7 @@
 #define itkUpdateMalcolmSparseLevelSet_hxx
 
 #include "itkConnectedImageNeighborhoodShape.h"
+#include "itkImageDuplicator.h"
 #include "itkMath.h"
 
 
@@ -51,13 +52,26 @@ UpdateMalcolmSparseLevelSet<VDimension, TEquationContainer>::Update()
   this->m_OutputLevelSet->SetLabelMap(this->m_InputLevelSet->GetModifiableLabelMap());
   this->m_OutputLevelSet->SetDomainOffset(this->m_Offset);
 
-  using LabelMapToLabelImageFilterType = LabelMapToLabelImageFilter<LevelSetLabelMapType, LabelImageType>;
-  auto labelMapToLabelImageFilter = LabelMapToLabelImageFilterType::New();
-  labelMapToLabelImageFilter->SetInput(this->m_InputLevelSet->GetLabelMap());
-  labelMapToLabelImageFilter->Update();
+  if (const LabelImageType * statusImage = this->m_InputLevelSet->GetStatusImage())
+  {
+    // The layer ids are already available as an image: copy it, rather than
+    // computing it from the label map.
+    using DuplicatorType = ImageDuplicator<LabelImageType>;
+    auto duplicator = DuplicatorType::New();
+    duplicator->SetInputImage(statusImage);
+    duplicator->Update();
+    this->m_InternalImage = duplicator->GetOutput();
+  }
+  else
+  {
+    using LabelMapToLabelImageFilterType = LabelMapToLabelImageFilter<LevelSetLabelMapType, LabelImageType>;
+    auto labelMapToLabelImageFilter = LabelMapToLabelImageFilterType::New();
+    labelMapToLabelImageFilter->SetInput(this->m_InputLevelSet->GetLabelMap());
+    labelMapToLabelImageFilter->Update();
 
-  this->m_InternalImage = labelMapToLabelImageFilter->GetOutput();
-  this->m_InternalImage->DisconnectPipeline();
+    this->m_InternalImage = labelMapToLabelImageFilter->GetOutput();
+    this->m_InternalImage->DisconnectPipeline();
+  }
 
   this->FillUpdateContainer();
 
@@ -119,6 +133,7 @@ UpdateMalcolmSparseLevelSet<VDimension, TEquationContainer>::Update()
 
   const LevelSetLabelMapPointer outputLabelMap = this->m_OutputLevelSet->GetModifiableLabelMap();
   outputLabelMap->Graft(labelImageToLabelMapFilter->GetOutput());
+  this->m_OutputLevelSet->SetStatusImage(this->m_InternalImage);
 }
 
 template <unsigned int VDimension, typename TEquationContainer>
@@ -20,6 +20,7 @@
 #define itkUpdateWhitakerSparseLevelSet_hxx
 
 #include "itkConnectedImageNeighborhoodShape.h"
+#include "itkImageDuplicator.h"
 
 namespace itk
 {
@@ -77,12 +78,25 @@ UpdateWhitakerSparseLevelSet<VDimension, TLevelSetValueType, TEquationContainer>
 
   this->m_OutputLevelSet->SetLabelMap(this->m_InputLevelSet->GetModifiableLabelMap());
 
-  auto labelMapToLabelImageFilter = LabelMapToLabelImageFilterType::New();
-  labelMapToLabelImageFilter->SetInput(this->m_InputLevelSet->GetLabelMap());
-  labelMapToLabelImageFilter->Update();
+  if (const LabelImageType * statusImage = this->m_InputLevelSet->GetStatusImage())
+  {
+    // The layer ids are already available as an image: copy it, rather than
+    // computing it from the label map.
+    using DuplicatorType = ImageDuplicator<LabelImageType>;
+    auto duplicator = DuplicatorType::New();
+    duplicator->SetInputImage(statusImage);
+    duplicator->Update();
+    this->m_InternalImage = duplicator->GetOutput();
+  }
+  else
+  {
+    auto labelMapToLabelImageFilter = LabelMapToLabelImageFilterType::New();
+    labelMapToLabelImageFilter->SetInput(this->m_InputLevelSet->GetLabelMap());
+    labelMapToLabelImageFilter->Update();
 
-  this->m_InternalImage = labelMapToLabelImageFilter->GetOutput();
-  this->m_InternalImage->DisconnectPipeline();
+    this->m_InternalImage = labelMapToLabelImageFilter->GetOutput();
+    this->m_InternalImage->DisconnectPipeline();
+  }
 
   this->m_TempPhi.clear();
 
@@ -171,6 +185,7 @@ UpdateWhitakerSparseLevelSet<VDimension, TLevelSetValueType, TEquationContainer>
   labelImageToLabelMapFilter->Update();
 
   this->m_OutputLevelSet->GetModifiableLabelMap()->Graft(labelImageToLabelMapFilter->GetOutput());
+  this->m_OutputLevelSet->SetStatusImage(this->m_InternalImage);
   this->m_TempPhi.clear();
 }
 
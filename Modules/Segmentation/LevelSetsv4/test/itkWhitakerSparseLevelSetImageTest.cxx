@@ -34,6 +34,7 @@ itkWhitakerSparseLevelSetImageTest(int, char *[])
 
   auto labelMap = LabelMapType::New();
   labelMap->SetBackgroundValue(3);
+  labelMap->SetRegions(LabelMapType::SizeType::Filled(10));
 
   for (int i = 0; i < 4; ++i)
   {
@@ -65,5 +66,20 @@ itkWhitakerSparseLevelSetImageTest(int, char *[])
     return EXIT_FAILURE;
   }
 
+  // The status image gives the same values as the label map.
+  ITK_TEST_EXPECT_TRUE(phi->GetStatusImage() == nullptr);
+  phi->ComputeStatusImage();
+  ITK_TEST_EXPECT_TRUE(phi->GetStatusImage() != nullptr);
+  ITK_TEST_EXPECT_EQUAL(phi->GetStatusImage()->GetPixel(index), -3);
+  ITK_TEST_EXPECT_EQUAL(phi->Status(index), -3);
+  ITK_TEST_EXPECT_EQUAL(phi->Evaluate(index), -3.0);
+
+  index[1] = 3;
+  ITK_TEST_EXPECT_EQUAL(phi->Status(index), 3);
+  ITK_TEST_EXPECT_EQUAL(phi->Evaluate(index), 3.0);
+
+  phi->SetLabelMap(labelMap);
+  ITK_TEST_EXPECT_TRUE(phi->GetStatusImage() == nullptr);
+
   return EXIT_SUCCESS;
 }
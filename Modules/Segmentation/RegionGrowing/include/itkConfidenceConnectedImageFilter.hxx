@@ -27,7 +27,8 @@
 #include "itkFloodFilledImageFunctionConditionalIterator.h"
 #include "itkProgressReporter.h"
 #include "itkPrintHelper.h"
-#include <algorithm> // For min and max.
+#include "itkScanlineFloodFill.h"
+#include <algorithm> // For fill_n, min and max.
 
 namespace itk
 {
@@ -124,7 +125,6 @@ ConfidenceConnectedImageFilter<TInputImage, TOutputImage>::GenerateData()
   using FunctionType = BinaryThresholdImageFunction<InputImageType, double>;
   using SecondFunctionType = BinaryThresholdImageFunction<OutputImageType, double>;
 
-  using IteratorType = FloodFilledImageFunctionConditionalIterator<OutputImageType, FunctionType>;
   using SecondIteratorType = FloodFilledImageFunctionConditionalConstIterator<InputImageType, SecondFunctionType>;
 
   const typename Superclass::InputImageConstPointer inputImage = this->GetInput();
@@ -268,20 +268,17 @@ ConfidenceConnectedImageFilter<TInputImage, TOutputImage>::GenerateData()
   itkDebugMacro("\nLower intensity = " << lower << ", Upper intensity = " << upper << "\nmean = " << m_Mean
                                        << " , std::sqrt(variance) = " << std::sqrt(m_Variance));
 
-  // Segment the image, the iterator walks the output image (so Set()
-  // writes into the output image), starting at the seed point.  As
-  // the iterator walks, if the corresponding pixel in the input image
-  // (accessed via the "function" assigned to the iterator) is within
-  // the [lower, upper] bounds prescribed, the pixel is added to the
-  // output segmentation and its neighbors become candidates for the
-  // iterator to walk.
-  IteratorType it(outputImage, function, m_Seeds);
-  it.GoToBegin();
-  while (!it.IsAtEnd())
-  {
-    it.Set(m_ReplaceValue);
-    ++it;
-  }
+  // Segment the image, flood filling the output image span by span,
+  // starting at the seed point.  If the corresponding pixel in the input
+  // image (accessed via the "function") is within the [lower, upper]
+  // bounds prescribed, the pixel is added to the output segmentation and
+  // its neighbors become candidates for the flood fill.
+  ScanlineFloodFill<OutputImageType::ImageDimension> floodFill(region);
+  const auto isIncluded = [function](const IndexType & index) { return function->EvaluateAtIndex(index); };
+  floodFill.Fill(m_Seeds, isIncluded, [outputImage, this](const IndexType & index, SizeValueType numberOfPixels) {
+    std::fill_n(outputImage->GetBufferPointer() + outputImage->ComputeOffset(index), numberOfPixels, m_ReplaceValue);
+    return true;
+  });
 
   ProgressReporter progress(this, 0, region.GetNumberOfPixels() * m_NumberOfIterations);
 
@@ -350,24 +347,21 @@ ConfidenceConnectedImageFilter<TInputImage, TOutputImage>::GenerateData()
                                          << " , std::sqrt(variance) = " << std::sqrt(m_Variance));
     itkDebugMacro("\nsum = " << sum << ", sumOfSquares = " << sumOfSquares << "\nnum = " << numberOfSamples);
 
-    // Rerun the segmentation, the iterator walks the output image,
-    // starting at the seed point.  As the iterator walks, if the
-    // corresponding pixel in the input image (accessed via the
-    // "function" assigned to the iterator) is within the [lower,
-    // upper] bounds prescribed, the pixel is added to the output
-    // segmentation and its neighbors become candidates for the
-    // iterator to walk.
+    // Rerun the segmentation, flood filling the output image from the
+    // seed point with the new [lower, upper] bounds.
     outputImage->FillBuffer(OutputImagePixelType{});
-    IteratorType thirdIt(outputImage, function, m_Seeds);
-    thirdIt.GoToBegin();
     try
     {
-      while (!thirdIt.IsAtEnd())
-      {
-        thirdIt.Set(m_ReplaceValue);
-        ++thirdIt;
-        progress.CompletedPixel(); // potential exception thrown here
-      }
+      floodFill.Fill(
+        m_Seeds, isIncluded, [outputImage, &progress, this](const IndexType & index, SizeValueType numberOfPixels) {
+          std::fill_n(
+            outputImage->GetBufferPointer() + outputImage->ComputeOffset(index), numberOfPixels, m_ReplaceValue);
+          for (SizeValueType i = 0; i < numberOfPixels; ++i)
+          {
+            progress.CompletedPixel(); // potential exception thrown here
+          }
+          return true;
+        });
     }
     catch (const ProcessAborted &)
     {
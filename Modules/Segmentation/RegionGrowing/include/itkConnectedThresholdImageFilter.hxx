@@ -19,12 +19,12 @@
 #define itkConnectedThresholdImageFilter_hxx
 
 #include "itkBinaryThresholdImageFunction.h"
-#include "itkFloodFilledImageFunctionConditionalIterator.h"
 #include "itkProgressReporter.h"
-
-#include "itkShapedFloodFilledImageFunctionConditionalIterator.h"
+#include "itkScanlineFloodFill.h"
 #include "itkMath.h"
 
+#include <algorithm> // For fill_n.
+
 namespace itk
 {
 
@@ -241,38 +241,20 @@ ConnectedThresholdImageFilter<TInputImage, TOutputImage>::GenerateData()
 
   ProgressReporter progress(this, 0, region.GetNumberOfPixels());
 
-  if (this->m_Connectivity == ConnectivityEnum::FaceConnectivity)
-  {
-    using IteratorType = FloodFilledImageFunctionConditionalIterator<OutputImageType, FunctionType>;
-    IteratorType it(outputImage, function, m_Seeds);
-    it.GoToBegin();
-
-    while (!it.IsAtEnd())
-    {
-      it.Set(m_ReplaceValue);
-      ++it;
-      progress.CompletedPixel(); // potential exception thrown here
-    }
-  }
-  else if (this->m_Connectivity == ConnectivityEnum::FullConnectivity)
-  {
-    // Use the fully connected iterator here. The fully connected iterator
-    // below is a superset of the above. However, it is reported to be 20%
-    // slower. Hence we use this "if" block to use the old iterator when
-    // we don't need full connectivity.
-
-    using IteratorType = ShapedFloodFilledImageFunctionConditionalIterator<OutputImageType, FunctionType>;
-    IteratorType it(outputImage, function, m_Seeds);
-    it.FullyConnectedOn();
-    it.GoToBegin();
-
-    while (!it.IsAtEnd())
-    {
-      it.Set(m_ReplaceValue);
-      ++it;
-      progress.CompletedPixel(); // potential exception thrown here
-    }
-  }
+  // Fill the output span by span.
+  ScanlineFloodFill<OutputImageDimension> floodFill(region,
+                                                    this->m_Connectivity == ConnectivityEnum::FullConnectivity);
+  floodFill.Fill(
+    m_Seeds,
+    [function](const IndexType & index) { return function->EvaluateAtIndex(index); },
+    [outputImage, &progress, this](const IndexType & index, SizeValueType numberOfPixels) {
+      std::fill_n(outputImage->GetBufferPointer() + outputImage->ComputeOffset(index), numberOfPixels, m_ReplaceValue);
+      for (SizeValueType i = 0; i < numberOfPixels; ++i)
+      {
+        progress.CompletedPixel(); // potential exception thrown here
+      }
+      return true;
+    });
 }
 
 template <typename TInputImage, typename TOutputImage>
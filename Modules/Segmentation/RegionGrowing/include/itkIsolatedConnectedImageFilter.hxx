@@ -19,13 +19,15 @@
 #define itkIsolatedConnectedImageFilter_hxx
 
 #include "itkBinaryThresholdImageFunction.h"
-#include "itkFloodFilledImageFunctionConditionalIterator.h"
 #include "itkProgressReporter.h"
+#include "itkScanlineFloodFill.h"
 #include "itkIterationReporter.h"
 #include "itkMath.h"
 #include "itkNumericTraits.h"
 #include "itkPrintHelper.h"
 
+#include <algorithm> // For fill_n.
+
 namespace itk
 {
 
@@ -185,14 +187,39 @@ IsolatedConnectedImageFilter<TInputImage, TOutputImage>::GenerateData()
   outputImage->AllocateInitialized();
 
   using FunctionType = BinaryThresholdImageFunction<InputImageType>;
-  using IteratorType = FloodFilledImageFunctionConditionalIterator<OutputImageType, FunctionType>;
 
   auto function = FunctionType::New();
   function->SetInputImage(inputImage);
 
+  // Fills the output from the first seeds, span by span. The flood fill may
+  // stop as soon as the first of the second seeds is filled, when only the
+  // inclusion of the second seeds matters.
+  ScanlineFloodFill<OutputImageType::ImageDimension> floodFill(region);
+  const auto fillFromSeeds1 = [&floodFill, function, outputImage, this](ProgressReporter & progress, bool stopAtSeed2) {
+    const IndexType & seed2 = m_Seeds2.front();
+    floodFill.Fill(
+      m_Seeds1,
+      [function](const IndexType & index) { return function->EvaluateAtIndex(index); },
+      [outputImage, &progress, stopAtSeed2, &seed2, this](const IndexType & index, SizeValueType numberOfPixels) {
+        std::fill_n(
+          outputImage->GetBufferPointer() + outputImage->ComputeOffset(index), numberOfPixels, m_ReplaceValue);
+        for (SizeValueType i = 0; i < numberOfPixels; ++i)
+        {
+          progress.CompletedPixel(); // potential exception thrown here
+        }
+        if (stopAtSeed2)
+        {
+          typename OutputImageRegionType::SizeType spanSize;
+          spanSize.Fill(1);
+          spanSize[0] = numberOfPixels;
+          return !OutputImageRegionType(index, spanSize).IsInside(seed2);
+        }
+        return true;
+      });
+  };
+
   float             progressWeight = 0.0f;
   float             cumulatedProgress = 0.0f;
-  IteratorType      it(outputImage, function, m_Seeds1);
   IterationReporter iterate(this, 0, 1);
 
   // If the upper threshold has not been set, find it.
@@ -217,17 +244,7 @@ IsolatedConnectedImageFilter<TInputImage, TOutputImage>::GenerateData()
       cumulatedProgress += progressWeight;
       outputImage->FillBuffer(OutputImagePixelType{});
       function->ThresholdBetween(m_Lower, static_cast<InputImagePixelType>(guess));
-      it.GoToBegin();
-      while (!it.IsAtEnd())
-      {
-        it.Set(m_ReplaceValue);
-        if (it.GetIndex() == m_Seeds2.front())
-        {
-          break;
-        }
-        ++it;
-        progress.CompletedPixel(); // potential exception thrown here
-      }
+      fillFromSeeds1(progress, true);
       // If any of second seeds are included, decrease the upper bound.
       // Find the sum of the intensities in m_Seeds2.  If the second
       // seeds are not included, the sum should be zero.  Otherwise,
@@ -282,17 +299,7 @@ IsolatedConnectedImageFilter<TInputImage, TOutputImage>::GenerateData()
       cumulatedProgress += progressWeight;
       outputImage->FillBuffer(OutputImagePixelType{});
       function->ThresholdBetween(static_cast<InputImagePixelType>(guess), m_Upper);
-      it.GoToBegin();
-      while (!it.IsAtEnd())
-      {
-        it.Set(m_ReplaceValue);
-        if (it.GetIndex() == m_Seeds2.front())
-        {
-          break;
-        }
-        ++it;
-        progress.CompletedPixel(); // potential exception thrown here
-      }
+      fillFromSeeds1(progress, true);
       // If any of second seeds are included, increase the lower bound.
       // Find the sum of the intensities in m_Seeds2.  If the second
       // seeds are not included, the sum should be zero.  Otherwise,
@@ -339,13 +346,7 @@ IsolatedConnectedImageFilter<TInputImage, TOutputImage>::GenerateData()
   {
     function->ThresholdBetween(m_IsolatedValue, m_Upper);
   }
-  it.GoToBegin();
-  while (!it.IsAtEnd())
-  {
-    it.Set(m_ReplaceValue);
-    ++it;
-    progress.CompletedPixel(); // potential exception thrown here
-  }
+  fillFromSeeds1(progress, false);
 
   // If any of the second seeds are included or some of the first
   // seeds are not included, the algorithm could not find any threshold
@@ -19,9 +19,11 @@
 #define itkNeighborhoodConnectedImageFilter_hxx
 
 #include "itkNeighborhoodBinaryThresholdImageFunction.h"
-#include "itkFloodFilledImageFunctionConditionalIterator.h"
 #include "itkProgressReporter.h"
 #include "itkPrintHelper.h"
+#include "itkScanlineFloodFill.h"
+
+#include <algorithm> // For fill_n.
 
 namespace itk
 {
@@ -113,21 +115,27 @@ NeighborhoodConnectedImageFilter<TInputImage, TOutputImage>::GenerateData()
   outputImage->AllocateInitialized();
 
   using FunctionType = NeighborhoodBinaryThresholdImageFunction<InputImageType>;
-  using IteratorType = FloodFilledImageFunctionConditionalIterator<OutputImageType, FunctionType>;
 
   auto function = FunctionType::New();
   function->SetInputImage(inputImage);
   function->ThresholdBetween(m_Lower, m_Upper);
   function->SetRadius(m_Radius);
-  IteratorType it(outputImage, function, m_Seeds);
 
   ProgressReporter progress(this, 0, outputImage->GetRequestedRegion().GetNumberOfPixels());
-  while (!it.IsAtEnd())
-  {
-    it.Set(m_ReplaceValue);
-    ++it;
-    progress.CompletedPixel();
-  }
+
+  // Fill the output span by span.
+  ScanlineFloodFill<OutputImageDimension> floodFill(outputImage->GetRequestedRegion());
+  floodFill.Fill(
+    m_Seeds,
+    [function](const IndexType & index) { return function->EvaluateAtIndex(index); },
+    [outputImage, &progress, this](const IndexType & index, SizeValueType numberOfPixels) {
+      std::fill_n(outputImage->GetBufferPointer() + outputImage->ComputeOffset(index), numberOfPixels, m_ReplaceValue);
+      for (SizeValueType i = 0; i < numberOfPixels; ++i)
+      {
+        progress.CompletedPixel();
+      }
+      return true;
+    });
 }
 } // end namespace itk
 
@@ -0,0 +1,277 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkScanlineFloodFill_h
+#define itkScanlineFloodFill_h
+
+#include "itkImageRegion.h"
+
+#include <algorithm> // For max and min.
+#include <cstdint>   // For uint64_t.
+#include <vector>
+
+namespace itk
+{
+
+/**
+ * \class ScanlineFloodFill
+ * \brief Flood fill of a region, by spans of consecutive pixels along the
+ * first dimension.
+ *
+ * Fill() finds the pixels of the region that are connected to the seeds
+ * through pixels for which a predicate is true, as the
+ * FloodFilledImageFunctionConditionalIterator and
+ * ShapedFloodFilledImageFunctionConditionalIterator do. Instead of queueing
+ * every pixel, it grows each span of included pixels along its line at once,
+ * and queues the span, from which the adjacent lines are scanned. The filled
+ * pixels are reported span by span, so that they can be written with a
+ * single fill of the output buffer.
+ *
+ * The pixels that are filled, and the pixels for which the predicate is
+ * false, are recorded in two bit sets, so that the predicate is evaluated
+ * at most once per pixel, and the bookkeeping takes two bits per pixel.
+ *
+ * The pixels are connected through their faces, or, when FullyConnected is
+ * true, through their faces, edges and vertices.
+ *
+ * \sa FloodFilledImageFunctionConditionalIterator
+ * \ingroup ITKRegionGrowing
+ */
+template <unsigned int VDimension>
+class ScanlineFloodFill
+{
+public:
+  static constexpr unsigned int Dimension = VDimension;
+
+  using IndexType = Index<VDimension>;
+  using OffsetType = Offset<VDimension>;
+  using RegionType = ImageRegion<VDimension>;
+  using SeedsContainerType = std::vector<IndexType>;
+
+  /** Prepares the flood fill of the specified region. */
+  explicit ScanlineFloodFill(const RegionType & region, bool fullyConnected = false)
+    : m_Region(region)
+    , m_LineLength(region.GetSize(0))
+    , m_FullyConnected(fullyConnected)
+  {
+    // Offsets from a line to its adjacent lines, along the dimensions after
+    // the first one.
+    OffsetType lineOffset{};
+    this->AddLineOffsets(lineOffset, 1);
+
+    SizeValueType lineStride = 1;
+    for (unsigned int i = 1; i < VDimension; ++i)
+    {
+      m_LineStrides[i] = lineStride;
+      lineStride *= region.GetSize(i);
+    }
+  }
+
+  /** Fills the pixels connected to the seeds for which `isIncluded(index)` is
+   * true. Each span of filled pixels is reported by
+   * `visitSpan(firstIndex, numberOfPixels)`, which returns false to stop the
+   * flood fill. The seeds outside the region or not included are ignored. */
+  template <typename TIsIncluded, typename TVisitSpan>
+  void
+  Fill(const SeedsContainerType & seeds, TIsIncluded && isIncluded, TVisitSpan && visitSpan)
+  {
+    const SizeValueType numberOfWords = (m_Region.GetNumberOfPixels() + 63) / 64;
+    m_Filled.assign(numberOfWords, 0);
+    m_Excluded.assign(numberOfWords, 0);
+
+    std::vector<SpanType> stack;
+
+    // Fills the span through the specified pixel, if it is included and not
+    // filled yet.
+    const auto fillSpanAt = [this, &isIncluded, &visitSpan, &stack](const IndexType & index) {
+      const SizeValueType bit = this->ComputeBit(index);
+      if (GetBit(m_Filled, bit) || GetBit(m_Excluded, bit))
+      {
+        return true;
+      }
+      if (!isIncluded(index))
+      {
+        SetBit(m_Excluded, bit);
+        return true;
+      }
+
+      const IndexValueType lineStart = m_Region.GetIndex(0);
+      const IndexValueType lineEnd = lineStart + static_cast<IndexValueType>(m_LineLength);
+      const SizeValueType  lineBit = bit - static_cast<SizeValueType>(index[0] - lineStart);
+
+      // Grows the span in both directions, as long as the pixels are included.
+      const auto isGrowable = [this, &isIncluded, lineBit, lineStart](IndexType neighbor, IndexValueType x) {
+        const SizeValueType neighborBit = lineBit + static_cast<SizeValueType>(x - lineStart);
+        if (GetBit(m_Filled, neighborBit) || GetBit(m_Excluded, neighborBit))
+        {
+          return false;
+        }
+        neighbor[0] = x;
+        if (!isIncluded(neighbor))
+        {
+          SetBit(m_Excluded, neighborBit);
+          return false;
+        }
+        return true;
+      };
+      IndexValueType first = index[0];
+      while (first > lineStart && isGrowable(index, first - 1))
+      {
+        --first;
+      }
+      IndexValueType last = index[0];
+      while (last + 1 < lineEnd && isGrowable(index, last + 1))
+      {
+        ++last;
+      }
+
+      for (IndexValueType x = first; x <= last; ++x)
+      {
+        SetBit(m_Filled, lineBit + static_cast<SizeValueType>(x - lineStart));
+      }
+
+      SpanType span{ index, last - first + 1 };
+      span.FirstIndex[0] = first;
+      stack.push_back(span);
+      return static_cast<bool>(visitSpan(span.FirstIndex, static_cast<SizeValueType>(span.Length)));
+    };
+
+    for (const IndexType & seed : seeds)
+    {
+      if (m_Region.IsInside(seed) && !fillSpanAt(seed))
+      {
+        return;
+      }
+    }
+
+    // Scans the lines adjacent to each filled span. With full connectivity,
+    // the pixels diagonal to the ends of the span are scanned too.
+    const IndexValueType lineStart = m_Region.GetIndex(0);
+    const IndexValueType lineEnd = lineStart + static_cast<IndexValueType>(m_LineLength);
+    const IndexValueType margin = m_FullyConnected ? 1 : 0;
+    while (!stack.empty())
+    {
+      const SpanType span = stack.back();
+      stack.pop_back();
+
+      for (const OffsetType & lineOffset : m_LineOffsets)
+      {
+        IndexType neighbor = span.FirstIndex + lineOffset;
+        if (!this->IsLineInside(neighbor))
+        {
+          continue;
+        }
+        const IndexValueType first = std::max(span.FirstIndex[0] - margin, lineStart);
+        const IndexValueType last = std::min(span.FirstIndex[0] + span.Length - 1 + margin, lineEnd - 1);
+        for (neighbor[0] = first; neighbor[0] <= last; ++neighbor[0])
+        {
+          if (!fillSpanAt(neighbor))
+          {
+            return;
+          }
+        }
+      }
+    }
+  }
+
+private:
+  /** A span of filled pixels, and the index of its first pixel. */
+  struct SpanType
+  {
+    IndexType      FirstIndex;
+    IndexValueType Length;
+  };
+
+  /** Adds the offsets to the adjacent lines, for the dimensions from the
+   * specified one. */
+  void
+  AddLineOffsets(OffsetType & lineOffset, unsigned int dimension)
+  {
+    if (dimension < VDimension)
+    {
+      for (OffsetValueType step = -1; step <= 1; ++step)
+      {
+        lineOffset[dimension] = step;
+        this->AddLineOffsets(lineOffset, dimension + 1);
+      }
+      lineOffset[dimension] = 0;
+      return;
+    }
+
+    // Keep the adjacent lines, through a face only unless fully connected.
+    unsigned int numberOfSteps = 0;
+    for (unsigned int i = 1; i < VDimension; ++i)
+    {
+      numberOfSteps += (lineOffset[i] != 0) ? 1 : 0;
+    }
+    if (numberOfSteps == 1 || (numberOfSteps > 1 && m_FullyConnected))
+    {
+      m_LineOffsets.push_back(lineOffset);
+    }
+  }
+
+  /** Tells whether the line of the specified index is inside the region. */
+  [[nodiscard]] bool
+  IsLineInside(const IndexType & index) const
+  {
+    for (unsigned int i = 1; i < VDimension; ++i)
+    {
+      if (index[i] < m_Region.GetIndex(i) ||
+          index[i] >= m_Region.GetIndex(i) + static_cast<IndexValueType>(m_Region.GetSize(i)))
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /** Returns the position of the bit of a pixel of the region. */
+  [[nodiscard]] SizeValueType
+  ComputeBit(const IndexType & index) const
+  {
+    SizeValueType line = 0;
+    for (unsigned int i = 1; i < VDimension; ++i)
+    {
+      line += static_cast<SizeValueType>(index[i] - m_Region.GetIndex(i)) * m_LineStrides[i];
+    }
+    return line * m_LineLength + static_cast<SizeValueType>(index[0] - m_Region.GetIndex(0));
+  }
+
+  static bool
+  GetBit(const std::vector<uint64_t> & bits, SizeValueType bit)
+  {
+    return (bits[bit >> 6] >> (bit & 63)) & 1;
+  }
+
+  static void
+  SetBit(std::vector<uint64_t> & bits, SizeValueType bit)
+  {
+    bits[bit >> 6] |= uint64_t{ 1 } << (bit & 63);
+  }
+
+  RegionType              m_Region;
+  SizeValueType           m_LineLength;
+  bool                    m_FullyConnected;
+  SizeValueType           m_LineStrides[VDimension]{};
+  std::vector<OffsetType> m_LineOffsets{};
+  std::vector<uint64_t>   m_Filled{};
+  std::vector<uint64_t>   m_Excluded{};
+};
+
+} // end namespace itk
+
+#endif
@@ -0,0 +1,153 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+// First include the header file to be tested:
+#include "itkScanlineFloodFill.h"
+
+#include "itkBinaryThresholdImageFunction.h"
+#include "itkImage.h"
+#include "itkImageRegionIterator.h"
+#include "itkShapedFloodFilledImageFunctionConditionalConstIterator.h"
+#include "itkGTest.h"
+
+#include <random>
+
+namespace
+{
+using ImageType = itk::Image<unsigned char, 3>;
+using FunctionType = itk::BinaryThresholdImageFunction<ImageType>;
+
+// Creates an image whose pixels are 1 with the specified probability, and 0
+// otherwise.
+ImageType::Pointer
+CreateRandomImage(const ImageType::RegionType & region, double probability)
+{
+  auto image = ImageType::New();
+  image->SetRegions(region);
+  image->Allocate();
+
+  std::mt19937                        generator(42);
+  std::bernoulli_distribution         distribution(probability);
+  itk::ImageRegionIterator<ImageType> it(image, region);
+  for (; !it.IsAtEnd(); ++it)
+  {
+    it.Set(distribution(generator) ? 1 : 0);
+  }
+  return image;
+}
+
+// Checks that the scanline flood fill fills the same pixels as the shaped
+// flood filled iterator, and each of them once.
+void
+ExpectSameFillAsIterator(const ImageType * image, std::vector<ImageType::IndexType> seeds, bool fullyConnected)
+{
+  auto function = FunctionType::New();
+  function->SetInputImage(image);
+  function->ThresholdAbove(1);
+
+  const ImageType::RegionType & region = image->GetBufferedRegion();
+
+  auto expected = ImageType::New();
+  expected->SetRegions(region);
+  expected->AllocateInitialized();
+  itk::ShapedFloodFilledImageFunctionConditionalConstIterator<ImageType, FunctionType> it(image, function, seeds);
+  it.SetFullyConnected(fullyConnected);
+  for (it.GoToBegin(); !it.IsAtEnd(); ++it)
+  {
+    expected->SetPixel(it.GetIndex(), 1);
+  }
+
+  auto filled = ImageType::New();
+  filled->SetRegions(region);
+  filled->AllocateInitialized();
+  itk::ScanlineFloodFill<3> floodFill(region, fullyConnected);
+  floodFill.Fill(
+    seeds,
+    [function](const ImageType::IndexType & index) { return function->EvaluateAtIndex(index); },
+    [&filled](const ImageType::IndexType & index, itk::SizeValueType numberOfPixels) {
+      ImageType::IndexType pixelIndex = index;
+      for (itk::SizeValueType i = 0; i < numberOfPixels; ++i, ++pixelIndex[0])
+      {
+        EXPECT_EQ(filled->GetPixel(pixelIndex), 0);
+        filled->SetPixel(pixelIndex, 1);
+      }
+      return true;
+    });
+
+  EXPECT_EQ(*filled, *expected);
+}
+} // namespace
+
+
+TEST(ScanlineFloodFill, FillsSameRegionAsFloodFilledIterator)
+{
+  const ImageType::RegionType region({ { -2, 3, 1 } }, { { 23, 17, 11 } });
+  for (const double probability : { 0.3, 0.6, 0.9 })
+  {
+    const auto                              image = CreateRandomImage(region, probability);
+    const std::vector<ImageType::IndexType> seeds{ { { 5, 10, 6 } }, { { -2, 3, 1 } }, { { 20, 19, 11 } } };
+    for (const bool fullyConnected : { false, true })
+    {
+      ExpectSameFillAsIterator(image, seeds, fullyConnected);
+    }
+  }
+}
+
+
+TEST(ScanlineFloodFill, IgnoresSeedsOutsideRegion)
+{
+  const ImageType::RegionType region({ { 0, 0, 0 } }, { { 8, 8, 8 } });
+  itk::ScanlineFloodFill<3>   floodFill(region);
+
+  itk::SizeValueType numberOfPixels = 0;
+  floodFill.Fill(
+    { { { 8, 0, 0 } }, { { 0, -1, 0 } } },
+    [](const ImageType::IndexType &) { return true; },
+    [&numberOfPixels](const ImageType::IndexType &, itk::SizeValueType n) {
+      numberOfPixels += n;
+      return true;
+    });
+  EXPECT_EQ(numberOfPixels, 0u);
+
+  floodFill.Fill(
+    { { { 3, 4, 5 } } },
+    [](const ImageType::IndexType &) { return true; },
+    [&numberOfPixels](const ImageType::IndexType &, itk::SizeValueType n) {
+      numberOfPixels += n;
+      return true;
+    });
+  EXPECT_EQ(numberOfPixels, region.GetNumberOfPixels());
+}
+
+
+TEST(ScanlineFloodFill, StopsWhenVisitSpanReturnsFalse)
+{
+  const ImageType::RegionType region({ { 0, 0, 0 } }, { { 8, 8, 8 } });
+  itk::ScanlineFloodFill<3>   floodFill(region);
+
+  unsigned int numberOfSpans = 0;
+  floodFill.Fill(
+    { { { 3, 4, 5 } } },
+    [](const ImageType::IndexType &) { return true; },
+    [&numberOfSpans](const ImageType::IndexType & index, itk::SizeValueType n) {
+      EXPECT_EQ(index[0], 0);
+      EXPECT_EQ(n, 8u);
+      return ++numberOfSpans < 3;
+    });
+  EXPECT_EQ(numberOfSpans, 3u);
+}
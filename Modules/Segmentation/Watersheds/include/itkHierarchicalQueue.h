@@ -0,0 +1,203 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkHierarchicalQueue_h
+#define itkHierarchicalQueue_h
+
+#include <cassert>
+#include <cstddef>     // For size_t.
+#include <limits>      // For numeric_limits.
+#include <queue>
+#include <type_traits> // For enable_if and is_integral.
+#include <vector>
+
+namespace itk
+{
+
+/**
+ * \class HierarchicalQueue
+ * \brief Hierarchical queue (FAH, "File d'Attente Hierarchique"), as used by
+ * the flooding algorithms of the morphological watersheds.
+ *
+ * A hierarchical queue is a set of FIFO queues, one per priority. Pop()
+ * returns the oldest value of the lowest priority.
+ *
+ * This generic implementation keeps the values in a binary heap, ordered by
+ * priority and then by insertion, so that any priority type with an
+ * operator<() is supported, at a logarithmic cost per Push() and Pop().
+ * A specialization for integral priorities of at most 16 bits keeps the
+ * queues in an array indexed by the priority (a bucket queue), so that
+ * Push() and Pop() take constant time.
+ *
+ * \ingroup ITKWatersheds
+ */
+template <typename TPriority, typename TValue, typename = void>
+class HierarchicalQueue
+{
+public:
+  using PriorityType = TPriority;
+  using ValueType = TValue;
+
+  /** Tells whether the queue has no value. */
+  [[nodiscard]] bool
+  IsEmpty() const
+  {
+    return m_Heap.empty();
+  }
+
+  /** Returns the lowest priority of the values in the queue, which must not
+   * be empty. */
+  [[nodiscard]] PriorityType
+  GetFrontPriority() const
+  {
+    assert(!this->IsEmpty());
+    return m_Heap.top().Priority;
+  }
+
+  /** Adds a value with the specified priority. */
+  void
+  Push(const PriorityType & priority, const ValueType & value)
+  {
+    m_Heap.push(ElementType{ priority, m_NumberOfPushes, value });
+    ++m_NumberOfPushes;
+  }
+
+  /** Removes and returns the oldest value of the lowest priority. The queue
+   * must not be empty. */
+  ValueType
+  Pop()
+  {
+    assert(!this->IsEmpty());
+    const ValueType value = m_Heap.top().Value;
+    m_Heap.pop();
+    return value;
+  }
+
+private:
+  /** A value, with its priority and the number of values pushed before it,
+   * which orders the values of the same priority. */
+  struct ElementType
+  {
+    PriorityType Priority;
+    size_t       Order;
+    ValueType    Value;
+
+    /** Comparison for a min-heap. */
+    bool
+    operator<(const ElementType & other) const
+    {
+      return other.Priority < Priority || (!(Priority < other.Priority) && other.Order < Order);
+    }
+  };
+
+  std::priority_queue<ElementType> m_Heap{};
+  size_t                           m_NumberOfPushes{ 0 };
+};
+
+
+/** Bucket queue specialization of HierarchicalQueue, for integral priorities
+ * of at most 16 bits.
+ * \ingroup ITKWatersheds */
+template <typename TPriority, typename TValue>
+class HierarchicalQueue<TPriority,
+                        TValue,
+                        std::enable_if_t<std::is_integral_v<TPriority> && (sizeof(TPriority) <= 2)>>
+{
+public:
+  using PriorityType = TPriority;
+  using ValueType = TValue;
+
+  HierarchicalQueue()
+    : m_Buckets(ToBucket(std::numeric_limits<PriorityType>::max()) + 1)
+    , m_Heads(m_Buckets.size())
+  {}
+
+  /** Tells whether the queue has no value. */
+  [[nodiscard]] bool
+  IsEmpty() const
+  {
+    return m_Size == 0;
+  }
+
+  /** Returns the lowest priority of the values in the queue, which must not
+   * be empty. */
+  [[nodiscard]] PriorityType
+  GetFrontPriority() const
+  {
+    assert(!this->IsEmpty());
+    return static_cast<PriorityType>(static_cast<ptrdiff_t>(m_Front) + std::numeric_limits<PriorityType>::lowest());
+  }
+
+  /** Adds a value with the specified priority. */
+  void
+  Push(const PriorityType & priority, const ValueType & value)
+  {
+    const size_t bucket = ToBucket(priority);
+    if (m_Size == 0 || bucket < m_Front)
+    {
+      m_Front = bucket;
+    }
+    m_Buckets[bucket].push_back(value);
+    ++m_Size;
+  }
+
+  /** Removes and returns the oldest value of the lowest priority. The queue
+   * must not be empty. */
+  ValueType
+  Pop()
+  {
+    assert(!this->IsEmpty());
+    std::vector<ValueType> & bucket = m_Buckets[m_Front];
+    size_t &                 head = m_Heads[m_Front];
+    const ValueType          value = bucket[head];
+    ++head;
+    --m_Size;
+    if (head == bucket.size())
+    {
+      // Release the memory of the bucket, and move to the next non-empty one.
+      std::vector<ValueType>().swap(bucket);
+      head = 0;
+      if (m_Size > 0)
+      {
+        while (m_Buckets[m_Front].empty())
+        {
+          ++m_Front;
+        }
+      }
+    }
+    return value;
+  }
+
+private:
+  static size_t
+  ToBucket(const PriorityType priority)
+  {
+    return static_cast<size_t>(static_cast<ptrdiff_t>(priority) -
+                               static_cast<ptrdiff_t>(std::numeric_limits<PriorityType>::lowest()));
+  }
+
+  /** The values of each priority, and the position of their oldest value. */
+  std::vector<std::vector<ValueType>> m_Buckets;
+  std::vector<size_t>                 m_Heads;
+
+  size_t m_Front{ 0 };
+  size_t m_Size{ 0 };
+};
+
+} // end namespace itk
+
+#endif
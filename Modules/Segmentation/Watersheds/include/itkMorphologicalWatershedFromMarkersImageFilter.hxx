@@ -18,9 +18,7 @@
 #ifndef itkMorphologicalWatershedFromMarkersImageFilter_hxx
 #define itkMorphologicalWatershedFromMarkersImageFilter_hxx
 
-#include <algorithm>
-#include <queue>
-#include <list>
+#include "itkHierarchicalQueue.h"
 #include "itkProgressReporter.h"
 #include "itkImageRegionIterator.h"
 #include "itkConstShapedNeighborhoodIterator.h"
@@ -111,10 +109,9 @@ MorphologicalWatershedFromMarkersImageFilter<TInputImage, TLabelImage>::Generate
     itkExceptionStringMacro("Marker and input must have the same size.");
   }
 
-  // FAH (in french: File d'Attente Hierarchique)
-  using QueueType = std::queue<IndexType>;
-  using MapType = std::map<InputImagePixelType, QueueType>;
-  MapType fah;
+  // FAH (in french: File d'Attente Hierarchique). It is a bucket queue for
+  // the pixel types of at most 16 bits.
+  HierarchicalQueue<InputImagePixelType, IndexType> fah;
 
   // the radius which will be used for all the shaped iterators
   constexpr auto radius = Size<ImageDimension>::Filled(1);
@@ -212,7 +209,7 @@ MorphologicalWatershedFromMarkersImageFilter<TInputImage, TLabelImage>::Generate
           {
             // this neighbor is a background pixel and is not already
             // processed; add its index to fah
-            fah[niIt.Get()].push(markerIt.GetIndex() + nmIt.GetNeighborhoodOffset());
+            fah.Push(niIt.Get(), markerIt.GetIndex() + nmIt.GetNeighborhoodOffset());
             // mark it as already in the fah to avoid adding it several times
             nsIt.Set(true);
           }
@@ -242,70 +239,65 @@ MorphologicalWatershedFromMarkersImageFilter<TInputImage, TLabelImage>::Generate
     inputIt.GoToBegin();
 
     // and start flooding
-    while (!fah.empty())
+    while (!fah.IsEmpty())
     {
-      // store the current vars
-      const InputImagePixelType currentValue = fah.begin()->first;
-      QueueType                 currentQueue = fah.begin()->second;
-      // and remove them from the fah
-      fah.erase(fah.begin());
-
-      while (!currentQueue.empty())
+      // the pixels are flooded level by level, the lowest first, in the order
+      // in which they are added to their level
+      const InputImagePixelType currentValue = fah.GetFrontPriority();
+      const IndexType           idx = fah.Pop();
+
+      // move the iterators to the right place
+      const OffsetType shift = idx - outputIt.GetIndex();
+      outputIt += shift;
+      statusIt += shift;
+      inputIt += shift;
+
+      // iterate over the neighbors. If there is only one marker value, give
+      // that value to the pixel, else keep it as is (watershed line)
+      LabelImagePixelType marker = wsLabel;
+      bool                collision = false;
+      for (noIt = outputIt.Begin(); noIt != outputIt.End(); ++noIt)
       {
-        const IndexType idx = currentQueue.front();
-        currentQueue.pop();
-
-        // move the iterators to the right place
-        const OffsetType shift = idx - outputIt.GetIndex();
-        outputIt += shift;
-        statusIt += shift;
-        inputIt += shift;
-
-        // iterate over the neighbors. If there is only one marker value, give
-        // that value to the pixel, else keep it as is (watershed line)
-        LabelImagePixelType marker = wsLabel;
-        bool                collision = false;
-        for (noIt = outputIt.Begin(); noIt != outputIt.End(); ++noIt)
+        const LabelImagePixelType o = noIt.Get();
+        if (o != wsLabel)
         {
-          const LabelImagePixelType o = noIt.Get();
-          if (o != wsLabel)
+          if (marker != wsLabel && o != marker)
           {
-            if (marker != wsLabel && o != marker)
-            {
-              collision = true;
-              break;
-            }
-
-            marker = o;
+            collision = true;
+            break;
           }
+
+          marker = o;
         }
-        if (!collision)
+      }
+      if (!collision)
+      {
+        // set the marker value
+        outputIt.SetCenterPixel(marker);
+        // and propagate to the neighbors
+        for (niIt = inputIt.Begin(), nsIt = statusIt.Begin(); niIt != inputIt.End(); ++niIt, ++nsIt)
         {
-          // set the marker value
-          outputIt.SetCenterPixel(marker);
-          // and propagate to the neighbors
-          for (niIt = inputIt.Begin(), nsIt = statusIt.Begin(); niIt != inputIt.End(); ++niIt, ++nsIt)
+          if (!nsIt.Get())
           {
-            if (!nsIt.Get())
+            // the pixel is not yet processed. add it to the fah
+            const InputImagePixelType GrayVal = niIt.Get();
+            // a pixel lower than the current level is flooded at the
+            // current level
+            if (GrayVal <= currentValue)
+            {
+              fah.Push(currentValue, inputIt.GetIndex() + niIt.GetNeighborhoodOffset());
+            }
+            else
             {
-              // the pixel is not yet processed. add it to the fah
-              const InputImagePixelType GrayVal = niIt.Get();
-              if (GrayVal <= currentValue)
-              {
-                currentQueue.push(inputIt.GetIndex() + niIt.GetNeighborhoodOffset());
-              }
-              else
-              {
-                fah[GrayVal].push(inputIt.GetIndex() + niIt.GetNeighborhoodOffset());
-              }
-              // mark it as already in the fah
-              nsIt.Set(true);
+              fah.Push(GrayVal, inputIt.GetIndex() + niIt.GetNeighborhoodOffset());
             }
+            // mark it as already in the fah
+            nsIt.Set(true);
           }
         }
-        // one more pixel in the flooding stage
-        progress.CompletedPixel();
       }
+      // one more pixel in the flooding stage
+      progress.CompletedPixel();
     }
   }
 
@@ -350,7 +342,7 @@ MorphologicalWatershedFromMarkersImageFilter<TInputImage, TLabelImage>::Generate
         if (haveBgNeighbor)
         {
           // there is a background pixel in the neighborhood; add to fah
-          fah[inputIt.GetCenterPixel()].push(markerIt.GetIndex());
+          fah.Push(inputIt.GetCenterPixel(), markerIt.GetIndex());
         }
         else
         {
@@ -373,45 +365,40 @@ MorphologicalWatershedFromMarkersImageFilter<TInputImage, TLabelImage>::Generate
     inputIt.GoToBegin();
 
     // and start flooding
-    while (!fah.empty())
+    while (!fah.IsEmpty())
     {
-      // store the current vars
-      const InputImagePixelType currentValue = fah.begin()->first;
-      QueueType                 currentQueue = fah.begin()->second;
-      // and remove them from the fah
-      fah.erase(fah.begin());
-
-      while (!currentQueue.empty())
+      // the pixels are flooded level by level, the lowest first, in the order
+      // in which they are added to their level
+      const InputImagePixelType currentValue = fah.GetFrontPriority();
+      const IndexType           idx = fah.Pop();
+
+      // move the iterators to the right place
+      const OffsetType shift = idx - outputIt.GetIndex();
+      outputIt += shift;
+      inputIt += shift;
+
+      const LabelImagePixelType currentMarker = outputIt.GetCenterPixel();
+      // get the current value of the pixel
+      // iterate over neighbors to propagate the marker
+      for (noIt = outputIt.Begin(), niIt = inputIt.Begin(); noIt != outputIt.End(); ++noIt, ++niIt)
       {
-        const IndexType idx = currentQueue.front();
-        currentQueue.pop();
-
-        // move the iterators to the right place
-        const OffsetType shift = idx - outputIt.GetIndex();
-        outputIt += shift;
-        inputIt += shift;
-
-        const LabelImagePixelType currentMarker = outputIt.GetCenterPixel();
-        // get the current value of the pixel
-        // iterate over neighbors to propagate the marker
-        for (noIt = outputIt.Begin(), niIt = inputIt.Begin(); noIt != outputIt.End(); ++noIt, ++niIt)
+        if (noIt.Get() == wsLabel)
         {
-          if (noIt.Get() == wsLabel)
+          // the pixel is not yet processed. It can be labeled with the
+          // current label
+          noIt.Set(currentMarker);
+          const InputImagePixelType GrayVal = niIt.Get();
+          // a pixel lower than the current level is flooded at the
+          // current level
+          if (GrayVal <= currentValue)
           {
-            // the pixel is not yet processed. It can be labeled with the
-            // current label
-            noIt.Set(currentMarker);
-            const InputImagePixelType GrayVal = niIt.Get();
-            if (GrayVal <= currentValue)
-            {
-              currentQueue.push(inputIt.GetIndex() + noIt.GetNeighborhoodOffset());
-            }
-            else
-            {
-              fah[GrayVal].push(inputIt.GetIndex() + noIt.GetNeighborhoodOffset());
-            }
-            progress.CompletedPixel();
+            fah.Push(currentValue, inputIt.GetIndex() + noIt.GetNeighborhoodOffset());
+          }
+          else
+          {
+            fah.Push(GrayVal, inputIt.GetIndex() + noIt.GetNeighborhoodOffset());
           }
+          progress.CompletedPixel();
         }
       }
     }
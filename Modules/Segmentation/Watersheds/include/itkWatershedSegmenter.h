@@ -23,6 +23,9 @@
 #include "itkWatershedSegmentTable.h"
 #include "itkEquivalencyTable.h"
 
+#include <utility> // For pair.
+#include <vector>
+
 namespace itk::watershed
 {
 /**
@@ -280,13 +283,17 @@ protected:
     typename InputImageType::OffsetType * direction;
   };
 
-  /** Table for storing tables of edges.  This is convenient in
-   * generating the segment table,  even though the edge tables
-   * are stored as ordered lists.  An "edge" in this context
-   * is synonymous with a segment "adjacency".   */
-  using edge_table_t = std::map<IdentifierType, InputPixelType>;
+  /** Table for storing the edges of a segment while generating the segment
+   * table: the labels of the adjacent segments, each with the lowest height
+   * of the edge between them.  An "edge" in this context is synonymous with
+   * a segment "adjacency".  The table is a flat array, which is sorted by
+   * label and compacted only once it has doubled in size, rather than a
+   * node-based map updated for every pixel.   */
+  using edge_table_t = std::vector<std::pair<IdentifierType, InputPixelType>>;
 
-  using edge_table_hash_t = std::unordered_map<IdentifierType, edge_table_t>;
+  /** The edge table of each segment, with the size of the table when it was
+   * last compacted. */
+  using edge_table_hash_t = std::unordered_map<IdentifierType, std::pair<edge_table_t, size_t>>;
 
   Segmenter();
   Segmenter(const Self &) {}
@@ -360,16 +367,18 @@ protected:
    * into another. The source and destination regions must match in size (not
    * enforced).  For integral types, the dynamic range of the image is
    * adjusted such that the maximum value in the image is always at
-   * least one less than the maximum value allowed for that data type. */
-  static void
+   * least one less than the maximum value allowed for that data type.
+   * The region is processed in parallel by the multi-threader. */
+  void
   Threshold(InputImageTypePointer destination,
             InputImageTypePointer source,
             const ImageRegionType source_region,
             const ImageRegionType destination_region,
             InputPixelType        threshold);
 
-  /** Helper function.  Finds the minimum and maximum values in an image. */
-  static void
+  /** Helper function.  Finds the minimum and maximum values in an image,
+   * processing the region in parallel. */
+  void
   MinMax(InputImageTypePointer img, ImageRegionType region, InputPixelType & min, InputPixelType & max);
 
   /** Helper function. Finds the minimum and maximum values in an image.   */
@@ -21,6 +21,8 @@
 #include "itkMath.h"
 #include "itkNeighborhoodAlgorithm.h"
 #include "itkImageRegionIterator.h"
+#include <algorithm> // For sort.
+#include <mutex>
 #include <stack>
 #include <list>
 
@@ -892,6 +894,24 @@ Segmenter<TInputImage>::UpdateSegmentTable(InputImageTypePointer input, ImageReg
 
   const IdentifierType hoodCenter = searchIt.Size() >> 1;
 
+  // Sorts an edge table by label, and keeps only the lowest edge of each
+  // adjacent segment.
+  const auto compactEdgeTable = [](edge_table_t & edgeTable) {
+    std::sort(edgeTable.begin(), edgeTable.end());
+    auto last = edgeTable.begin();
+    for (auto edge = edgeTable.begin(); edge != edgeTable.end(); ++edge)
+    {
+      if (edge->first != last->first)
+      {
+        *(++last) = *edge;
+      }
+    }
+    if (!edgeTable.empty())
+    {
+      edgeTable.erase(last + 1, edgeTable.end());
+    }
+  };
+
   edge_table_hash_t edgeHash;
   for (searchIt.GoToBegin(), labelIt.GoToBegin(); !searchIt.IsAtEnd(); ++searchIt, ++labelIt)
   {
@@ -901,59 +921,43 @@ Segmenter<TInputImage>::UpdateSegmentTable(InputImageTypePointer input, ImageReg
     // and update its minimum value if necessary.
 
     typename SegmentTableType::segment_t * segment_ptr = segments->Lookup(segment_label);
-    auto                                   edge_table_entry_ptr = edgeHash.find(segment_label);
-    const edge_table_t                     tempEdgeTable;
     if (segment_ptr == nullptr) // This segment not yet identified.
     {
       // So add it to the table.
       typename SegmentTableType::segment_t temp_segment;
       temp_segment.min = searchIt.GetPixel(hoodCenter);
       segments->Add(segment_label, temp_segment);
-      using ValueType = typename edge_table_hash_t::value_type;
-
-      edgeHash.insert(ValueType(segment_label, tempEdgeTable));
-
-      edge_table_entry_ptr = edgeHash.find(segment_label);
     }
     else if (searchIt.GetPixel(hoodCenter) < segment_ptr->min)
     {
       segment_ptr->min = searchIt.GetPixel(hoodCenter);
     }
+    auto & [edgeTable, compactedSize] = edgeHash[segment_label];
 
-    // Look up each neighboring segment in this segment's edge table.
-    // If an edge exists, compare (and reset) the minimum edge value.
-    // Note that edges are located *between* two adjacent pixels and
-    // the value is taken to be the maximum of the two adjacent pixel
-    // values.
+    // Record an edge with each neighboring segment.  Note that edges are
+    // located *between* two adjacent pixels and the value is taken to be the
+    // maximum of the two adjacent pixel values.  The duplicate edges are
+    // only resolved to the minimum value when the table is compacted.
     for (unsigned int i = 0; i < m_Connectivity.size; ++i)
     {
       const unsigned int nPos = m_Connectivity.index[i];
-      InputPixelType     lowest_edge;
       if (labelIt.GetPixel(nPos) != segment_label && labelIt.GetPixel(nPos) != NULL_LABEL)
       {
         if (searchIt.GetPixel(nPos) < searchIt.GetPixel(hoodCenter))
         {
-          lowest_edge = searchIt.GetPixel(hoodCenter); // We want the
+          edgeTable.emplace_back(labelIt.GetPixel(nPos), searchIt.GetPixel(hoodCenter));
         }
         else
         {
-          lowest_edge = searchIt.GetPixel(nPos); // max of the
-        }
-        // adjacent pixels
-
-        const auto edge_ptr = edge_table_entry_ptr->second.find(labelIt.GetPixel(nPos));
-        if (edge_ptr == edge_table_entry_ptr->second.end())
-        {
-          // This edge has not been identified yet.
-          using ValueType = typename edge_table_t::value_type;
-          edge_table_entry_ptr->second.insert(ValueType(labelIt.GetPixel(nPos), lowest_edge));
-        }
-        else if (lowest_edge < edge_ptr->second)
-        {
-          edge_ptr->second = lowest_edge;
+          edgeTable.emplace_back(labelIt.GetPixel(nPos), searchIt.GetPixel(nPos));
         }
       }
     }
+    if (edgeTable.size() > 2 * compactedSize + m_Connectivity.size)
+    {
+      compactEdgeTable(edgeTable);
+      compactedSize = edgeTable.size();
+    }
   }
 
   //
@@ -969,21 +973,17 @@ Segmenter<TInputImage>::UpdateSegmentTable(InputImageTypePointer input, ImageReg
       itkGenericExceptionMacro("UpdateSegmentTable:: An unexpected and fatal error has occurred.");
     }
 
-    // Copy into the segment list
-    const auto listsz = static_cast<IdentifierType>(edge_table_entry_ptr->second.size());
-    segment_ptr->edge_list.resize(listsz);
-    auto edge_ptr = edge_table_entry_ptr->second.begin();
-    auto list_ptr = segment_ptr->edge_list.begin();
-    while (edge_ptr != edge_table_entry_ptr->second.end())
+    // Copy into the segment list, ordered by label
+    edge_table_t & edgeTable = edge_table_entry_ptr->second.first;
+    compactEdgeTable(edgeTable);
+    segment_ptr->edge_list.clear();
+    for (const auto & edge : edgeTable)
     {
-      list_ptr->label = edge_ptr->first;
-      list_ptr->height = edge_ptr->second;
-      ++edge_ptr;
-      ++list_ptr;
+      segment_ptr->edge_list.emplace_back(edge.first, edge.second);
     }
 
     // Clean up memory as we go
-    edge_table_entry_ptr->second.clear();
+    edge_table_t().swap(edgeTable);
   }
 }
 
@@ -1041,21 +1041,41 @@ Segmenter<TInputImage>::MinMax(InputImageTypePointer img,
                                InputPixelType &      min,
                                InputPixelType &      max)
 {
-  ImageRegionIterator it(img, region);
-  min = it.Value();
-  max = it.Value();
-  while (!it.IsAtEnd())
-  {
-    if (it.Get() > max)
-    {
-      max = it.Get();
-    }
-    if (it.Get() < min)
-    {
-      min = it.Get();
-    }
-    ++it;
-  }
+  min = img->GetPixel(region.GetIndex());
+  max = min;
+
+  // Each chunk of the region is scanned independently, and the extrema of
+  // the chunks are merged.
+  std::mutex mutex;
+  this->GetMultiThreader()->template ParallelizeImageRegion<ImageDimension>(
+    region,
+    [img, &min, &max, &mutex](const ImageRegionType & chunk) {
+      ImageRegionConstIterator it(img, chunk);
+      InputPixelType           chunkMin = it.Get();
+      InputPixelType           chunkMax = it.Get();
+      for (; !it.IsAtEnd(); ++it)
+      {
+        if (it.Get() > chunkMax)
+        {
+          chunkMax = it.Get();
+        }
+        if (it.Get() < chunkMin)
+        {
+          chunkMin = it.Get();
+        }
+      }
+
+      const std::lock_guard<std::mutex> lock(mutex);
+      if (chunkMax > max)
+      {
+        max = chunkMax;
+      }
+      if (chunkMin < min)
+      {
+        min = chunkMin;
+      }
+    },
+    nullptr);
 }
 
 template <typename TInputImage>
@@ -1115,57 +1135,66 @@ Segmenter<TInputImage>::Threshold(InputImageTypePointer destination,
                                   const ImageRegionType destination_region,
                                   InputPixelType        threshold)
 {
-  ImageRegionIterator dIt(destination, destination_region);
-  ImageRegionIterator sIt(source, source_region);
-
   // Assumes that source_region and destination region are the same size.  Does
-  // no checking!!
-  if (NumericTraits<InputPixelType>::is_integer)
-  {
-    // integral data type, if any pixel is at the maximum possible
-    // value for the data type, then drop the value by one intensity
-    // value. This the watershed algorithm to construct a "barrier" or
-    // "wall" around the image that will stop the watershed without
-    // requiring an expensive boundary condition checks.
-    while (!dIt.IsAtEnd())
-    {
-      const InputPixelType tmp = sIt.Get();
-      ITK_GCC_PRAGMA_PUSH
-      ITK_GCC_SUPPRESS_Wfloat_equal
-      if (tmp < threshold)
-      {
-        dIt.Set(threshold);
-      }
-      else if (tmp == NumericTraits<InputPixelType>::max())
-      {
-        dIt.Set(tmp - NumericTraits<InputPixelType>::OneValue());
-      }
-      else
+  // no checking!!  The chunks of the source region are thresholded in
+  // parallel, each into the matching chunk of the destination region.
+  const typename ImageRegionType::OffsetType destinationOffset =
+    destination_region.GetIndex() - source_region.GetIndex();
+
+  this->GetMultiThreader()->template ParallelizeImageRegion<ImageDimension>(
+    source_region,
+    [destination, source, destinationOffset, threshold](const ImageRegionType & chunk) {
+      ImageRegionIterator      dIt(destination, ImageRegionType(chunk.GetIndex() + destinationOffset, chunk.GetSize()));
+      ImageRegionConstIterator sIt(source, chunk);
+
+      if (NumericTraits<InputPixelType>::is_integer)
       {
-        dIt.Set(tmp);
-      }
-      ITK_GCC_PRAGMA_POP
-      ++dIt;
-      ++sIt;
-    }
-  }
-  else
-  {
-    // floating point data, no need to worry about overflow
-    while (!dIt.IsAtEnd())
-    {
-      if (sIt.Get() < threshold)
-      {
-        dIt.Set(threshold);
+        // integral data type, if any pixel is at the maximum possible
+        // value for the data type, then drop the value by one intensity
+        // value. This the watershed algorithm to construct a "barrier" or
+        // "wall" around the image that will stop the watershed without
+        // requiring an expensive boundary condition checks.
+        while (!dIt.IsAtEnd())
+        {
+          const InputPixelType tmp = sIt.Get();
+          ITK_GCC_PRAGMA_PUSH
+          ITK_GCC_SUPPRESS_Wfloat_equal
+          if (tmp < threshold)
+          {
+            dIt.Set(threshold);
+          }
+          else if (tmp == NumericTraits<InputPixelType>::max())
+          {
+            dIt.Set(tmp - NumericTraits<InputPixelType>::OneValue());
+          }
+          else
+          {
+            dIt.Set(tmp);
+          }
+          ITK_GCC_PRAGMA_POP
+          ++dIt;
+          ++sIt;
+        }
       }
       else
       {
-        dIt.Set(sIt.Get());
+        // floating point data, no need to worry about overflow
+        while (!dIt.IsAtEnd())
+        {
+          if (sIt.Get() < threshold)
+          {
+            dIt.Set(threshold);
+          }
+          else
+          {
+            dIt.Set(sIt.Get());
+          }
+          ++dIt;
+          ++sIt;
+        }
       }
-      ++dIt;
-      ++sIt;
-    }
-  }
+    },
+    nullptr);
 }
 
 /*
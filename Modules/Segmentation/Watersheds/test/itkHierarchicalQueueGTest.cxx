@@ -0,0 +1,111 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+
+// First include the header file to be tested:
+#include "itkHierarchicalQueue.h"
+
+#include <gtest/gtest.h>
+#include <algorithm> // For max.
+#include <map>
+#include <queue>
+#include <random>
+
+namespace
+{
+// Pushes and pops random values, at random priorities that are never lower than the priority being popped, as the
+// flooding algorithms do, and checks the order against a map of FIFO queues.
+template <typename TPriority>
+void
+ExpectSameOrderAsMapOfQueues(const int minimumPriority, const int maximumPriority)
+{
+  itk::HierarchicalQueue<TPriority, int> queue;
+  std::map<TPriority, std::queue<int>>   expectedQueues;
+  std::mt19937                           randomNumberEngine(42);
+  std::uniform_int_distribution<int>     priorityDistribution(minimumPriority, maximumPriority);
+
+  const auto push = [&](const TPriority priority, const int value) {
+    queue.Push(priority, value);
+    expectedQueues[priority].push(value);
+  };
+
+  for (int value = 0; value < 100; ++value)
+  {
+    push(static_cast<TPriority>(priorityDistribution(randomNumberEngine)), value);
+  }
+
+  int value = 100;
+  while (!queue.IsEmpty())
+  {
+    ASSERT_FALSE(expectedQueues.empty());
+    const auto expectedFront = expectedQueues.begin();
+    EXPECT_EQ(queue.GetFrontPriority(), expectedFront->first);
+    EXPECT_EQ(queue.Pop(), expectedFront->second.front());
+
+    const TPriority currentPriority = expectedFront->first;
+    expectedFront->second.pop();
+    if (expectedFront->second.empty())
+    {
+      expectedQueues.erase(expectedFront);
+    }
+
+    if (value < 1000)
+    {
+      push(std::max(currentPriority, static_cast<TPriority>(priorityDistribution(randomNumberEngine))), value++);
+      if (value % 3 == 0)
+      {
+        push(currentPriority, value++);
+      }
+    }
+  }
+  EXPECT_TRUE(expectedQueues.empty());
+}
+} // namespace
+
+
+TEST(HierarchicalQueue, BucketQueuePopsLowestPriorityFirstInFifoOrder)
+{
+  ExpectSameOrderAsMapOfQueues<unsigned char>(0, 255);
+  ExpectSameOrderAsMapOfQueues<short>(-300, 300);
+  ExpectSameOrderAsMapOfQueues<unsigned short>(1000, 1010);
+}
+
+
+TEST(HierarchicalQueue, HeapPopsLowestPriorityFirstInFifoOrder)
+{
+  ExpectSameOrderAsMapOfQueues<int>(-300, 300);
+  ExpectSameOrderAsMapOfQueues<float>(0, 10);
+  ExpectSameOrderAsMapOfQueues<double>(-1, 1);
+}
+
+
+TEST(HierarchicalQueue, AcceptsLowerPrioritiesBeforePopping)
+{
+  itk::HierarchicalQueue<unsigned char, int> queue;
+  EXPECT_TRUE(queue.IsEmpty());
+  queue.Push(200, 1);
+  queue.Push(10, 2);
+  queue.Push(200, 3);
+  queue.Push(0, 4);
+  EXPECT_EQ(queue.GetFrontPriority(), 0);
+  EXPECT_EQ(queue.Pop(), 4);
+  EXPECT_EQ(queue.Pop(), 2);
+  EXPECT_EQ(queue.GetFrontPriority(), 200);
+  EXPECT_EQ(queue.Pop(), 1);
+  EXPECT_EQ(queue.Pop(), 3);
+  EXPECT_TRUE(queue.IsEmpty());
+}
@@ -0,0 +1,79 @@
+#!/usr/bin/env python3
+
+"""Compare two Google Benchmark JSON results of ITKBenchmarks.
+
+Reports the relative change of the time of every benchmark found in both
+files, and exits with a non-zero status when any benchmark is slower than the
+baseline by more than the threshold. When the results hold aggregates of
+repetitions, their medians are compared.
+"""
+
+import argparse
+import json
+import sys
+
+
+def load_times(file_name, time_key):
+    with open(file_name) as results_file:
+        benchmarks = json.load(results_file)["benchmarks"]
+
+    medians = {
+        benchmark["run_name"]: benchmark[time_key]
+        for benchmark in benchmarks
+        if benchmark.get("aggregate_name") == "median"
+    }
+    if medians:
+        return medians
+    return {
+        benchmark["name"]: benchmark[time_key]
+        for benchmark in benchmarks
+        if benchmark.get("run_type", "iteration") == "iteration"
+    }
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("baseline", help="JSON results to compare against.")
+    parser.add_argument("current", help="JSON results to check.")
+    parser.add_argument(
+        "--threshold",
+        type=float,
+        default=0.10,
+        help="Relative slowdown reported as a regression (default: 0.10).",
+    )
+    parser.add_argument(
+        "--time",
+        choices=["real_time", "cpu_time"],
+        default="real_time",
+        help="Time to compare (default: real_time).",
+    )
+    args = parser.parse_args()
+
+    baseline = load_times(args.baseline, args.time)
+    current = load_times(args.current, args.time)
+
+    regressions = []
+    width = max((len(name) for name in current), default=0)
+    for name in sorted(current):
+        if name not in baseline:
+            print(f"{name:<{width}}  new")
+            continue
+        change = current[name] / baseline[name] - 1.0
+        status = ""
+        if change > args.threshold:
+            status = "REGRESSION"
+            regressions.append(name)
+        print(f"{name:<{width}}  {change:+8.1%}  {status}".rstrip())
+    for name in sorted(set(baseline) - set(current)):
+        print(f"{name:<{width}}  missing")
+
+    if regressions:
+        print(
+            f"{len(regressions)} benchmark(s) slower than the baseline by more than {args.threshold:.0%}."
+        )
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,78 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#ifndef itkBenchmarkImages_h
+#define itkBenchmarkImages_h
+
+#include "itkImage.h"
+#include "itkImageBufferRange.h"
+#include "itkIndexRange.h"
+#include <benchmark/benchmark.h>
+#include <random>
+
+namespace itk::Benchmark
+{
+
+/** Make an image of the given size along each dimension, filled with
+ * reproducible random values between 0 and 255. */
+template <typename TImage>
+typename TImage::Pointer
+MakeRandomImage(SizeValueType size)
+{
+  auto image = TImage::New();
+  image->SetRegions(TImage::SizeType::Filled(size));
+  image->Allocate();
+
+  std::mt19937                          generator(20240613);
+  std::uniform_real_distribution<float> distribution(0.0f, 255.0f);
+  for (auto && pixel : ImageBufferRange<TImage>(*image))
+  {
+    pixel = static_cast<typename TImage::PixelType>(distribution(generator));
+  }
+  return image;
+}
+
+/** Make an image of the given size along each dimension, containing a ball
+ * of foreground value 1 on a background of 0, roughly filling half of it. */
+template <typename TImage>
+typename TImage::Pointer
+MakeBallImage(SizeValueType size)
+{
+  auto image = TImage::New();
+  image->SetRegions(TImage::SizeType::Filled(size));
+  image->AllocateInitialized();
+
+  const double radius = 0.4 * size;
+  const double center = 0.5 * (size - 1);
+  for (const auto & index : ImageRegionIndexRange<TImage::ImageDimension>(image->GetBufferedRegion()))
+  {
+    double squaredDistance = 0.0;
+    for (unsigned int d = 0; d < TImage::ImageDimension; ++d)
+    {
+      squaredDistance += (index[d] - center) * (index[d] - center);
+    }
+    if (squaredDistance <= radius * radius)
+    {
+      image->SetPixel(index, 1);
+    }
+  }
+  return image;
+}
+
+} // namespace itk::Benchmark
+
+#endif
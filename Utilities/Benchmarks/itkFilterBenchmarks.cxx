@@ -0,0 +1,132 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#include "itkBenchmarkImages.h"
+
+#include "itkAffineTransform.h"
+#include "itkBinaryDilateImageFilter.h"
+#include "itkDiscreteGaussianImageFilter.h"
+#include "itkFlatStructuringElement.h"
+#include "itkGrayscaleDilateImageFilter.h"
+#include "itkResampleImageFilter.h"
+#include "itkSignedMaurerDistanceMapImageFilter.h"
+#include "itkSmoothingRecursiveGaussianImageFilter.h"
+
+namespace
+{
+using ImageType = itk::Image<float, 3>;
+using LabelImageType = itk::Image<unsigned char, 3>;
+
+// Runs the filter on every iteration, without recreating it.
+template <typename TFilter>
+void
+UpdateRepeatedly(benchmark::State & state, TFilter * filter)
+{
+  for (auto _ : state)
+  {
+    filter->Modified();
+    filter->Update();
+  }
+  state.SetItemsProcessed(state.iterations() * filter->GetOutput()->GetBufferedRegion().GetNumberOfPixels());
+}
+
+
+void
+BM_ResampleImageFilter(benchmark::State & state)
+{
+  const auto image = itk::Benchmark::MakeRandomImage<ImageType>(state.range(0));
+
+  using TransformType = itk::AffineTransform<double, 3>;
+  auto                            transform = TransformType::New();
+  TransformType::OutputVectorType axis;
+  axis.Fill(1.0);
+  transform->Rotate3D(axis, 0.1);
+
+  using FilterType = itk::ResampleImageFilter<ImageType, ImageType>;
+  auto filter = FilterType::New();
+  filter->SetInput(image);
+  filter->SetTransform(transform);
+  filter->UseReferenceImageOn();
+  filter->SetReferenceImage(image);
+  UpdateRepeatedly(state, filter.GetPointer());
+}
+BENCHMARK(BM_ResampleImageFilter)->Arg(64)->Arg(128)->Unit(benchmark::kMillisecond);
+
+
+void
+BM_DiscreteGaussianImageFilter(benchmark::State & state)
+{
+  using FilterType = itk::DiscreteGaussianImageFilter<ImageType, ImageType>;
+  auto filter = FilterType::New();
+  filter->SetInput(itk::Benchmark::MakeRandomImage<ImageType>(state.range(0)));
+  filter->SetVariance(4.0);
+  UpdateRepeatedly(state, filter.GetPointer());
+}
+BENCHMARK(BM_DiscreteGaussianImageFilter)->Arg(64)->Arg(128)->Unit(benchmark::kMillisecond);
+
+
+void
+BM_SmoothingRecursiveGaussianImageFilter(benchmark::State & state)
+{
+  using FilterType = itk::SmoothingRecursiveGaussianImageFilter<ImageType, ImageType>;
+  auto filter = FilterType::New();
+  filter->SetInput(itk::Benchmark::MakeRandomImage<ImageType>(state.range(0)));
+  filter->SetSigma(2.0);
+  UpdateRepeatedly(state, filter.GetPointer());
+}
+BENCHMARK(BM_SmoothingRecursiveGaussianImageFilter)->Arg(64)->Arg(128)->Unit(benchmark::kMillisecond);
+
+
+void
+BM_GrayscaleDilateImageFilter(benchmark::State & state)
+{
+  using KernelType = itk::FlatStructuringElement<3>;
+  using FilterType = itk::GrayscaleDilateImageFilter<ImageType, ImageType, KernelType>;
+  auto filter = FilterType::New();
+  filter->SetInput(itk::Benchmark::MakeRandomImage<ImageType>(state.range(0)));
+  filter->SetKernel(KernelType::Ball(KernelType::RadiusType::Filled(2)));
+  UpdateRepeatedly(state, filter.GetPointer());
+}
+BENCHMARK(BM_GrayscaleDilateImageFilter)->Arg(32)->Arg(64)->Unit(benchmark::kMillisecond);
+
+
+void
+BM_BinaryDilateImageFilter(benchmark::State & state)
+{
+  using KernelType = itk::FlatStructuringElement<3>;
+  using FilterType = itk::BinaryDilateImageFilter<LabelImageType, LabelImageType, KernelType>;
+  auto filter = FilterType::New();
+  filter->SetInput(itk::Benchmark::MakeBallImage<LabelImageType>(state.range(0)));
+  filter->SetKernel(KernelType::Ball(KernelType::RadiusType::Filled(2)));
+  filter->SetForegroundValue(1);
+  UpdateRepeatedly(state, filter.GetPointer());
+}
+BENCHMARK(BM_BinaryDilateImageFilter)->Arg(64)->Arg(128)->Unit(benchmark::kMillisecond);
+
+
+void
+BM_SignedMaurerDistanceMapImageFilter(benchmark::State & state)
+{
+  using FilterType = itk::SignedMaurerDistanceMapImageFilter<LabelImageType, ImageType>;
+  auto filter = FilterType::New();
+  filter->SetInput(itk::Benchmark::MakeBallImage<LabelImageType>(state.range(0)));
+  filter->SquaredDistanceOff();
+  filter->UseImageSpacingOn();
+  UpdateRepeatedly(state, filter.GetPointer());
+}
+BENCHMARK(BM_SignedMaurerDistanceMapImageFilter)->Arg(64)->Arg(128)->Unit(benchmark::kMillisecond);
+} // namespace
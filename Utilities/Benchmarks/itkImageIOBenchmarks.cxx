@@ -0,0 +1,54 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#include "itkBenchmarkImages.h"
+
+#include "itkImageFileReader.h"
+#include "itkImageFileWriter.h"
+#include "itkMetaImageIOFactory.h"
+#include <cstdio>
+#include <filesystem>
+
+namespace
+{
+using ImageType = itk::Image<float, 3>;
+
+// Reads a MetaImage file, written uncompressed or compressed as given by the
+// second argument.
+void
+BM_MetaImageRead(benchmark::State & state)
+{
+  itk::MetaImageIOFactory::RegisterOneFactory();
+
+  const bool        compressed = state.range(1) != 0;
+  const std::string fileName =
+    (std::filesystem::temp_directory_path() / (compressed ? "itkBenchmarkCompressed.mha" : "itkBenchmark.mha"))
+      .string();
+  itk::WriteImage(itk::Benchmark::MakeRandomImage<ImageType>(state.range(0)), fileName, compressed);
+  const auto fileSize = static_cast<int64_t>(std::filesystem::file_size(fileName));
+
+  for (auto _ : state)
+  {
+    const ImageType::Pointer image = itk::ReadImage<ImageType>(fileName);
+    benchmark::DoNotOptimize(image->GetBufferPointer());
+  }
+  state.SetBytesProcessed(state.iterations() * fileSize);
+
+  std::remove(fileName.c_str());
+}
+BENCHMARK(BM_MetaImageRead)->Args({ 128, 0 })->Args({ 128, 1 })->Unit(benchmark::kMillisecond);
+} // namespace
@@ -0,0 +1,66 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#include "itkBenchmarkImages.h"
+
+#include "itkBSplineInterpolateImageFunction.h"
+#include "itkLinearInterpolateImageFunction.h"
+#include "itkNearestNeighborInterpolateImageFunction.h"
+#include <vector>
+
+namespace
+{
+using ImageType = itk::Image<float, 3>;
+
+// Evaluates the interpolator at reproducible random positions inside the image.
+template <typename TInterpolator>
+void
+BM_Interpolator(benchmark::State & state)
+{
+  constexpr itk::SizeValueType size = 64;
+  constexpr size_t             numberOfPoints = 100000;
+
+  const auto image = itk::Benchmark::MakeRandomImage<ImageType>(size);
+  auto       interpolator = TInterpolator::New();
+  interpolator->SetInputImage(image);
+
+  std::mt19937                                 generator(20240613);
+  std::uniform_real_distribution<double>       distribution(0.0, size - 1.0);
+  std::vector<itk::ContinuousIndex<double, 3>> indices(numberOfPoints);
+  for (auto & index : indices)
+  {
+    for (unsigned int d = 0; d < 3; ++d)
+    {
+      index[d] = distribution(generator);
+    }
+  }
+
+  for (auto _ : state)
+  {
+    double sum = 0.0;
+    for (const auto & index : indices)
+    {
+      sum += interpolator->EvaluateAtContinuousIndex(index);
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * numberOfPoints);
+}
+BENCHMARK_TEMPLATE(BM_Interpolator, itk::NearestNeighborInterpolateImageFunction<ImageType>);
+BENCHMARK_TEMPLATE(BM_Interpolator, itk::LinearInterpolateImageFunction<ImageType>);
+BENCHMARK_TEMPLATE(BM_Interpolator, itk::BSplineInterpolateImageFunction<ImageType>);
+} // namespace
@@ -0,0 +1,106 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#include "itkBenchmarkImages.h"
+
+#include "itkImageBufferRange.h"
+#include "itkImageNeighborhoodOffsets.h"
+#include "itkImageRegionConstIterator.h"
+#include "itkImageRegionRange.h"
+#include "itkIndexRange.h"
+#include "itkShapedImageNeighborhoodRange.h"
+#include <numeric>
+
+namespace
+{
+using ImageType = itk::Image<float, 3>;
+
+void
+BM_ImageRegionConstIterator(benchmark::State & state)
+{
+  const auto image = itk::Benchmark::MakeRandomImage<ImageType>(state.range(0));
+
+  for (auto _ : state)
+  {
+    float sum = 0.0f;
+    for (itk::ImageRegionConstIterator<ImageType> it(image, image->GetBufferedRegion()); !it.IsAtEnd(); ++it)
+    {
+      sum += it.Get();
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * image->GetBufferedRegion().GetNumberOfPixels());
+}
+BENCHMARK(BM_ImageRegionConstIterator)->Arg(64)->Arg(128);
+
+
+void
+BM_ImageRegionRange(benchmark::State & state)
+{
+  const auto image = itk::Benchmark::MakeRandomImage<ImageType>(state.range(0));
+
+  // A region one pixel smaller than the buffer, so that the range cannot
+  // simply iterate over the buffer.
+  ImageType::RegionType region = image->GetBufferedRegion();
+  region.ShrinkByRadius(1);
+
+  for (auto _ : state)
+  {
+    const itk::ImageRegionRange<const ImageType> range(*image, region);
+    benchmark::DoNotOptimize(std::accumulate(range.cbegin(), range.cend(), 0.0f));
+  }
+  state.SetItemsProcessed(state.iterations() * region.GetNumberOfPixels());
+}
+BENCHMARK(BM_ImageRegionRange)->Arg(64)->Arg(128);
+
+
+void
+BM_ImageBufferRange(benchmark::State & state)
+{
+  const auto image = itk::Benchmark::MakeRandomImage<ImageType>(state.range(0));
+
+  for (auto _ : state)
+  {
+    const itk::ImageBufferRange<const ImageType> range(*image);
+    benchmark::DoNotOptimize(std::accumulate(range.cbegin(), range.cend(), 0.0f));
+  }
+  state.SetItemsProcessed(state.iterations() * image->GetBufferedRegion().GetNumberOfPixels());
+}
+BENCHMARK(BM_ImageBufferRange)->Arg(64)->Arg(128);
+
+
+void
+BM_ShapedImageNeighborhoodRange(benchmark::State & state)
+{
+  const auto image = itk::Benchmark::MakeRandomImage<ImageType>(state.range(0));
+  const auto offsets = itk::GenerateRectangularImageNeighborhoodOffsets(ImageType::SizeType::Filled(1));
+
+  for (auto _ : state)
+  {
+    itk::ShapedImageNeighborhoodRange<const ImageType> neighborhood(*image, ImageType::IndexType(), offsets);
+    float                                              sum = 0.0f;
+    for (const ImageType::IndexType & index : itk::ImageRegionIndexRange<3>(image->GetBufferedRegion()))
+    {
+      neighborhood.SetLocation(index);
+      sum += std::accumulate(neighborhood.cbegin(), neighborhood.cend(), 0.0f);
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * image->GetBufferedRegion().GetNumberOfPixels());
+}
+BENCHMARK(BM_ShapedImageNeighborhoodRange)->Arg(32)->Arg(64);
+} // namespace
@@ -0,0 +1,68 @@
+/*=========================================================================
+ *
+ *  Copyright NumFOCUS
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *         https://www.apache.org/licenses/LICENSE-2.0.txt
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *=========================================================================*/
+#include "itkBenchmarkImages.h"
+
+#include "itkCorrelationImageToImageMetricv4.h"
+#include "itkMattesMutualInformationImageToImageMetricv4.h"
+#include "itkMeanSquaresImageToImageMetricv4.h"
+#include "itkTranslationTransform.h"
+
+namespace
+{
+using ImageType = itk::Image<float, 3>;
+
+// Evaluates the metric and its derivative for a translation of the moving
+// image, sampling every pixel of the fixed image.
+template <typename TMetric>
+void
+BM_ImageToImageMetricv4(benchmark::State & state)
+{
+  const auto fixedImage = itk::Benchmark::MakeRandomImage<ImageType>(state.range(0));
+  const auto movingImage = itk::Benchmark::MakeRandomImage<ImageType>(state.range(0));
+
+  using TransformType = itk::TranslationTransform<double, 3>;
+  auto                          transform = TransformType::New();
+  TransformType::ParametersType parameters(3);
+  parameters.Fill(0.5);
+  transform->SetParameters(parameters);
+
+  auto metric = TMetric::New();
+  metric->SetFixedImage(fixedImage);
+  metric->SetMovingImage(movingImage);
+  metric->SetMovingTransform(transform);
+  metric->Initialize();
+
+  typename TMetric::MeasureType    value;
+  typename TMetric::DerivativeType derivative;
+  for (auto _ : state)
+  {
+    metric->GetValueAndDerivative(value, derivative);
+    benchmark::DoNotOptimize(value);
+  }
+  state.SetItemsProcessed(state.iterations() * fixedImage->GetBufferedRegion().GetNumberOfPixels());
+}
+BENCHMARK_TEMPLATE(BM_ImageToImageMetricv4, itk::MeanSquaresImageToImageMetricv4<ImageType, ImageType>)
+  ->Arg(64)
+  ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_ImageToImageMetricv4, itk::CorrelationImageToImageMetricv4<ImageType, ImageType>)
+  ->Arg(64)
+  ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_ImageToImageMetricv4, itk::MattesMutualInformationImageToImageMetricv4<ImageType, ImageType>)
+  ->Arg(64)
+  ->Unit(benchmark::kMillisecond);
+} // namespace